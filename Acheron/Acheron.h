@@ -33,3 +33,4 @@
 #pragma once
 
 #include "AcheronComponentSystem.h"
+#include "Archetypes/AcheronArchetypeView.h"
@@ -39,17 +39,36 @@ namespace acs {
 	////////////////////////////////////////////////////////////////////////////////////////////
 	AcheronComponentSystem::AcheronComponentSystem( )
 		: AcheronContext{ },
+		m_job_system{ },
 		m_system_manager{ }
-	{ }
+	{ 
+		SetJobSystem( &m_job_system );
+	}
 
 	void AcheronComponentSystem::ResizeSystemPool( const uint32_t capacity ) {
 		m_system_manager.Resize( capacity );
 	}
 
+	void AcheronComponentSystem::ResizeWorkerPool( const uint32_t worker_count ) {
+		m_job_system.Resize( worker_count );
+	}
+
 	void AcheronComponentSystem::Process( void* user_data ) {
 		m_system_manager.Process( *this, user_data );
 	}
 
+	void AcheronComponentSystem::Process( void* user_data, const float delta_time ) {
+		m_system_manager.Process( *this, user_data, delta_time );
+	}
+
+	void AcheronComponentSystem::StartTrace( ) {
+		m_system_manager.StartTrace( );
+	}
+
+	void AcheronComponentSystem::StopTrace( std::ostream& stream ) {
+		m_system_manager.StopTrace( stream );
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////////////
 	//		===	PUBLIC GET ===
 	////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +41,7 @@ namespace acs {
 	{
 
 	private:
+		AcheronJobSystem m_job_system;
 		AcheronSystemManager m_system_manager;
 
 	public:
@@ -61,6 +62,15 @@ namespace acs {
 		 **/
 		void ResizeSystemPool( const uint32_t capacity );
 
+		/**
+		 * ResizeWorkerPool method
+		 * @note : Resize the job system worker pool shared by system 
+		 *		   scheduling and sweep, zero workers run everything on the
+		 *		   calling thread.
+		 * @param worker_count : New worker thread count.
+		 **/
+		void ResizeWorkerPool( const uint32_t worker_count );
+
 		/**
 		 * Process method
 		 * @note : Process all activated system.
@@ -69,6 +79,31 @@ namespace acs {
 		 **/
 		void Process( void* user_data );
 
+		/**
+		 * Process method
+		 * @note : Process all activated system with an explicit elapsed
+		 *		   time for tick policies.
+		 * @param user_data : Pointer to external data that can be pass to 
+		 *					  the process logic.
+		 * @param delta_time : Elapsed time since previous tick in seconds.
+		 **/
+		void Process( void* user_data, const float delta_time );
+
+		/**
+		 * StartTrace method
+		 * @note : Start recording a trace event per system run, requires
+		 *		   ACS_ENABLE_PROFILING.
+		 **/
+		void StartTrace( );
+
+		/**
+		 * StopTrace method
+		 * @note : Stop recording system runs and write them as Chrome trace
+		 *		   event JSON, requires ACS_ENABLE_PROFILING.
+		 * @param stream : Reference to the output stream.
+		 **/
+		void StopTrace( std::ostream& stream );
+
 	public:
 		/**
 		 * Register template function
@@ -85,6 +120,56 @@ namespace acs {
 			return m_system_manager.Register<SysType, ArgTypes...>( immediate_start, std::forward<ArgTypes>( args )... );
 		};
 
+		/**
+		 * SetStage method
+		 * @note : Set the stage of a collection of system.
+		 * @template SysTypes : Collection of system type.
+		 * @param stage : Target stage.
+		 **/
+		template<typename... SysTypes>
+			requires IsSystem<SysTypes...>
+		void SetStage( const AcheronSystemStages stage ) {
+			m_system_manager.SetStage<SysTypes...>( stage );
+		};
+
+		/**
+		 * SetTickPolicy method
+		 * @note : Set how often a collection of system run.
+		 * @template SysTypes : Collection of system type.
+		 * @param tick : Tick policy.
+		 **/
+		template<typename... SysTypes>
+			requires IsSystem<SysTypes...>
+		void SetTickPolicy( const AcheronSystemTick& tick ) {
+			m_system_manager.SetTickPolicy<SysTypes...>( tick );
+		};
+
+		/**
+		 * RunBefore method
+		 * @note : Make a system run before a collection of system of the
+		 *		   same stage.
+		 * @template SysType : System type.
+		 * @template OtherTypes : Collection of system running after SysType.
+		 **/
+		template<typename SysType, typename... OtherTypes>
+			requires IsSystem<SysType, OtherTypes...>
+		void RunBefore( ) {
+			m_system_manager.RunBefore<SysType, OtherTypes...>( );
+		};
+
+		/**
+		 * RunAfter method
+		 * @note : Make a system run after a collection of system of the 
+		 *		   same stage.
+		 * @template SysType : System type.
+		 * @template OtherTypes : Collection of system running before SysType.
+		 **/
+		template<typename SysType, typename... OtherTypes>
+			requires IsSystem<SysType, OtherTypes...>
+		void RunAfter( ) {
+			m_system_manager.RunAfter<SysType, OtherTypes...>( );
+		};
+
 		/**
 		 * Enable method
 		 * @note : Enable a collection of system.
@@ -172,7 +257,7 @@ namespace acs {
 		 **/
 		template<typename SysType>
 			requires IsSystem<SysType>
-		AcheronSystemInstance* Get( ) const {
+		AcheronSystemInstance* Get( ) {
 			return m_system_manager.Get<SysType>( );
 		};
 
@@ -188,6 +273,20 @@ namespace acs {
 			return m_system_manager.Get<SysType>( );
 		};
 
+		/**
+		 * GetProfile const template function
+		 * @note : Get a system profile.
+		 * @template SysType : System type.
+		 * @return Constant pointer to the system profile, nullptr when the
+		 *		   system isn't registered or ACS_ENABLE_PROFILING isn't 
+		 *		   defined.
+		 **/
+		template<typename SysType>
+			requires IsSystem<SysType>
+		const AcheronSystemProfile* GetProfile( ) const {
+			return m_system_manager.GetProfile<SysType>( );
+		};
+
 	public:
 		/**
 		 * Cast operator
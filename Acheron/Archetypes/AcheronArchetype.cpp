@@ -0,0 +1,205 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "_acheron_pch.h"
+
+namespace acs {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    AcheronArchetype::AcheronArchetype( const std::vector<const AcheronArchetypeType*>& types )
+        : m_columns{ },
+        m_chunks{ },
+        m_chunk_capacity{ 0 },
+        m_count{ 0 }
+    {
+        auto row_size = uint32_t( sizeof( AcheronUUID ) );
+        auto padding  = uint32_t( 0 );
+
+        for ( const auto* type : types ) {
+            ACS_ASSERT( type->Alignment <= alignof( std::max_align_t ), "Archetype component over aligned." );
+
+            row_size += type->Size;
+            padding  += type->Alignment;
+        }
+
+        ACS_ASSERT( row_size + padding <= ArchetypeChunkSize, "Archetype components don't fit in a chunk." );
+
+        m_chunk_capacity = ( ArchetypeChunkSize - padding ) / row_size;
+
+        auto offset = uint32_t( sizeof( AcheronUUID ) ) * m_chunk_capacity;
+
+        m_columns.reserve( types.size( ) );
+
+        for ( const auto* type : types ) {
+            offset = ( offset + type->Alignment - 1 ) & ~( type->Alignment - 1 );
+
+            m_columns.emplace_back( Column{ type, offset } );
+
+            offset += type->Size * m_chunk_capacity;
+        }
+    }
+
+    AcheronArchetype::~AcheronArchetype( ) {
+        for ( auto row = uint32_t( 0 ); row < m_count; row++ ) {
+            for ( auto column = uint32_t( 0 ); column < uint32_t( m_columns.size( ) ); column++ )
+                m_columns[ column ].Type->Destroy( GetComponent( column, row ) );
+        }
+    }
+
+    uint32_t AcheronArchetype::Allocate( const AcheronUUID entity ) {
+        if ( m_count == uint32_t( m_chunks.size( ) ) * m_chunk_capacity ) {
+            constexpr auto slots = ArchetypeChunkSize / sizeof( std::max_align_t );
+
+            m_chunks.emplace_back( std::make_unique_for_overwrite<std::max_align_t[]>( slots ) );
+        }
+
+        const auto row = m_count++;
+
+        GetEntities( row / m_chunk_capacity )[ row % m_chunk_capacity ] = entity;
+
+        return row;
+    }
+
+    AcheronUUID AcheronArchetype::Erase( const uint32_t row, const AcheronArchetype* target ) {
+        ACS_ASSERT( row < m_count, "Archetype row out of range." );
+
+        const auto last   = m_count - 1;
+        auto moved_entity = AcheronUUID{ };
+
+        for ( auto column = uint32_t( 0 ); column < uint32_t( m_columns.size( ) ); column++ ) {
+            const auto* type = m_columns[ column ].Type;
+
+            if ( !target || target->FindColumn( type->Id ) == Missing )
+                type->Destroy( GetComponent( column, row ) );
+
+            if ( row != last )
+                type->Move( GetComponent( column, row ), GetComponent( column, last ) );
+        }
+
+        if ( row != last ) {
+            moved_entity = GetEntity( last );
+
+            GetEntities( row / m_chunk_capacity )[ row % m_chunk_capacity ] = moved_entity;
+        }
+
+        m_count = last;
+
+        // Keep one spare chunk so an entity moving back and forth on a chunk
+        // boundary don't allocate each time.
+        const auto used_chunks = ( m_count + m_chunk_capacity - 1 ) / m_chunk_capacity;
+
+        while ( m_chunks.size( ) > size_t( used_chunks ) + 1 )
+            m_chunks.pop_back( );
+
+        return moved_entity;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC GET ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<const AcheronArchetypeType*> AcheronArchetype::GetTypes( ) const {
+        auto types = std::vector<const AcheronArchetypeType*>{ };
+
+        types.reserve( m_columns.size( ) );
+
+        for ( const auto& column : m_columns )
+            types.emplace_back( column.Type );
+
+        return types;
+    }
+
+    uint32_t AcheronArchetype::FindColumn( const uint64_t id ) const {
+        const auto iterator = std::lower_bound( 
+            m_columns.begin( ), 
+            m_columns.end( ), 
+            id, 
+            []( const Column& column, const uint64_t value ) { return column.Type->Id < value; }
+        );
+
+        if ( iterator == m_columns.end( ) || iterator->Type->Id != id )
+            return Missing;
+
+        return uint32_t( std::distance( m_columns.begin( ), iterator ) );
+    }
+
+    const AcheronArchetypeType& AcheronArchetype::GetColumnType( const uint32_t column ) const {
+        return *m_columns[ column ].Type;
+    }
+
+    uint32_t AcheronArchetype::GetColumnCount( ) const {
+        return uint32_t( m_columns.size( ) );
+    }
+
+    void* AcheronArchetype::GetColumn( const uint32_t chunk, const uint32_t column ) const {
+        auto* memory = reinterpret_cast<uint8_t*>( m_chunks[ chunk ].get( ) );
+
+        return memory + m_columns[ column ].Offset;
+    }
+
+    void* AcheronArchetype::GetComponent( const uint32_t column, const uint32_t row ) const {
+        auto* start = static_cast<uint8_t*>( GetColumn( row / m_chunk_capacity, column ) );
+
+        return start + size_t( row % m_chunk_capacity ) * m_columns[ column ].Type->Size;
+    }
+
+    AcheronUUID* AcheronArchetype::GetEntities( const uint32_t chunk ) const {
+        return reinterpret_cast<AcheronUUID*>( m_chunks[ chunk ].get( ) );
+    }
+
+    AcheronUUID AcheronArchetype::GetEntity( const uint32_t row ) const {
+        return GetEntities( row / m_chunk_capacity )[ row % m_chunk_capacity ];
+    }
+
+    uint32_t AcheronArchetype::GetChunkCount( ) const {
+        return uint32_t( m_chunks.size( ) );
+    }
+
+    uint32_t AcheronArchetype::GetChunkEntityCount( const uint32_t chunk ) const {
+        const auto start = chunk * m_chunk_capacity;
+
+        if ( start >= m_count )
+            return 0;
+
+        return std::min( m_chunk_capacity, m_count - start );
+    }
+
+    uint32_t AcheronArchetype::GetChunkCapacity( ) const {
+        return m_chunk_capacity;
+    }
+
+    uint32_t AcheronArchetype::GetCount( ) const {
+        return m_count;
+    }
+
+};
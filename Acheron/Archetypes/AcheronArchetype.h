@@ -0,0 +1,235 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "../Entities/AcheronEntityManager.h"
+#include "../Jobs/AcheronJobSystem.h"
+
+namespace acs {
+
+    // Archetype chunk size in bytes, each chunk hold the entity uuid's and 
+    // one column per archetype component.
+    static constexpr uint32_t ArchetypeChunkSize = 16 * 1024;
+
+    struct ACS_API AcheronArchetypeType {
+
+        uint64_t Id;
+        uint32_t Size;
+        uint32_t Alignment;
+        void ( *Move )( void* destination, void* source );
+        void ( *Destroy )( void* component );
+
+        /**
+         * Get static template function
+         * @note : Get a component type description, Move construct the 
+         *         destination from the source then destroy the source.
+         * @template CompType : Component type.
+         * @return Constant reference to the component type description.
+         **/
+        template<typename CompType>
+        static const AcheronArchetypeType& Get( ) {
+            static const auto type = AcheronArchetypeType{ 
+                AcheronUUID::Make<CompType>( ).Value,
+                uint32_t( sizeof( CompType ) ),
+                uint32_t( alignof( CompType ) ),
+                []( void* destination, void* source ) -> void {
+                    auto* component = static_cast<CompType*>( source );
+
+                    new ( destination ) CompType( std::move( *component ) );
+
+                    component->~CompType( );
+                },
+                []( void* component ) -> void {
+                    static_cast<CompType*>( component )->~CompType( );
+                }
+            };
+
+            return type;
+        };
+
+    };
+
+    class ACS_API AcheronArchetype final {
+
+        struct Column {
+
+            const AcheronArchetypeType* Type;
+            uint32_t Offset;
+
+        };
+
+    public:
+        // Column index returned when a component isn't part of the archetype.
+        static constexpr uint32_t Missing = UINT32_MAX;
+
+    private:
+        std::vector<Column> m_columns;
+        std::vector<std::unique_ptr<std::max_align_t[]>> m_chunks;
+        uint32_t m_chunk_capacity;
+        uint32_t m_count;
+
+    public:
+        /**
+         * Constructor
+         * @param types : Archetype component types sorted by id.
+         **/
+        AcheronArchetype( const std::vector<const AcheronArchetypeType*>& types );
+
+        /**
+         * Destructor
+         **/
+        ~AcheronArchetype( );
+
+        AcheronArchetype( const AcheronArchetype& ) = delete;
+        AcheronArchetype& operator=( const AcheronArchetype& ) = delete;
+
+        /**
+         * Allocate method
+         * @note : Append a row for an entity, components are left 
+         *         unconstructed for the caller.
+         * @param entity : Row entity.
+         * @return Row index.
+         **/
+        uint32_t Allocate( const AcheronUUID entity );
+
+        /**
+         * Erase method
+         * @note : Erase a row, the last row is moved in its place. Row 
+         *         components that are part of the target archetype must 
+         *         have been moved out, others are destroyed.
+         * @param row : Row index.
+         * @param target : Pointer to the archetype receiving the entity, 
+         *                 nullptr when the entity is destroyed.
+         * @return Uuid of the entity moved in the row, invalid when the 
+         *         erased row was the last one.
+         **/
+        AcheronUUID Erase( const uint32_t row, const AcheronArchetype* target );
+
+    public:
+        /**
+         * GetTypes const function
+         * @note : Get archetype component types sorted by id.
+         * @return Archetype component types.
+         **/
+        std::vector<const AcheronArchetypeType*> GetTypes( ) const;
+
+        /**
+         * FindColumn const function
+         * @note : Find a component column.
+         * @param id : Component type id.
+         * @return Column index or Missing.
+         **/
+        uint32_t FindColumn( const uint64_t id ) const;
+
+        /**
+         * GetColumnType const function
+         * @note : Get a column component type.
+         * @param column : Column index.
+         * @return Constant reference to the column component type.
+         **/
+        const AcheronArchetypeType& GetColumnType( const uint32_t column ) const;
+
+        /**
+         * GetColumnCount const function
+         * @note : Get archetype column count.
+         * @return Column count as uint32_t.
+         **/
+        uint32_t GetColumnCount( ) const;
+
+        /**
+         * GetColumn const function
+         * @note : Get a chunk column start.
+         * @param chunk : Chunk index.
+         * @param column : Column index.
+         * @return Pointer to the first component of the chunk column.
+         **/
+        void* GetColumn( const uint32_t chunk, const uint32_t column ) const;
+
+        /**
+         * GetComponent const function
+         * @note : Get a row component.
+         * @param column : Column index.
+         * @param row : Row index.
+         * @return Pointer to the row component.
+         **/
+        void* GetComponent( const uint32_t column, const uint32_t row ) const;
+
+        /**
+         * GetEntities const function
+         * @note : Get a chunk entity uuid's.
+         * @param chunk : Chunk index.
+         * @return Pointer to the first entity uuid of the chunk.
+         **/
+        AcheronUUID* GetEntities( const uint32_t chunk ) const;
+
+        /**
+         * GetEntity const function
+         * @note : Get a row entity.
+         * @param row : Row index.
+         * @return Row entity uuid.
+         **/
+        AcheronUUID GetEntity( const uint32_t row ) const;
+
+        /**
+         * GetChunkCount const function
+         * @note : Get allocated chunk count.
+         * @return Chunk count as uint32_t.
+         **/
+        uint32_t GetChunkCount( ) const;
+
+        /**
+         * GetChunkEntityCount const function
+         * @note : Get a chunk entity count, rows are dense so every chunk
+         *         is full but the last one.
+         * @param chunk : Chunk index.
+         * @return Chunk entity count as uint32_t.
+         **/
+        uint32_t GetChunkEntityCount( const uint32_t chunk ) const;
+
+        /**
+         * GetChunkCapacity const function
+         * @note : Get entity count a chunk can hold.
+         * @return Chunk capacity as uint32_t.
+         **/
+        uint32_t GetChunkCapacity( ) const;
+
+        /**
+         * GetCount const function
+         * @note : Get archetype entity count.
+         * @return Entity count as uint32_t.
+         **/
+        uint32_t GetCount( ) const;
+
+    };
+
+};
@@ -0,0 +1,344 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "_acheron_pch.h"
+
+namespace acs {
+
+    // Location of an entity without row, dead or never placed.
+    static constexpr uint32_t ArchetypeNone = UINT32_MAX;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    AcheronArchetypeContext::AcheronArchetypeContext( )
+        : m_entity_manager{ },
+        m_job_system{ nullptr },
+        m_archetypes{ },
+        m_add_edges{ },
+        m_remove_edges{ },
+        m_signatures{ },
+        m_locations{ },
+        m_lock_count{ 0 }
+    {
+        Clear( );
+    }
+
+    void AcheronArchetypeContext::Clear( ) {
+        ACS_ASSERT( !GetIsLocked( ), "Archetype context structural change while locked by a parallel iteration." );
+
+        m_entity_manager.Clear( false );
+        m_archetypes.clear( );
+        m_add_edges.clear( );
+        m_remove_edges.clear( );
+        m_signatures.clear( );
+        m_locations.clear( );
+
+        FindArchetype( { } );
+    }
+
+    void AcheronArchetypeContext::SetJobSystem( AcheronJobSystem* job_system ) {
+        m_job_system = job_system;
+    }
+
+    void AcheronArchetypeContext::SetReusePolicy( const AcheronReusePolicies policy ) {
+        m_entity_manager.SetReusePolicy( policy );
+    }
+
+    AcheronUUID AcheronArchetypeContext::Create( ) {
+        const auto entity = m_entity_manager.Create( );
+
+        Place( entity );
+
+        return entity;
+    }
+
+    void AcheronArchetypeContext::Create( const uint32_t count, std::span<AcheronUUID> entities ) {
+        ACS_ASSERT( entities.size( ) >= count, "Entity span must hold at least count uuids." );
+
+        auto targets = entities.first( count );
+
+        m_entity_manager.Create( targets );
+
+        for ( const auto entity : targets )
+            Place( entity );
+    }
+
+    void AcheronArchetypeContext::Destroy( const AcheronUUID entity, const bool use_sweep_destroy ) {
+        if ( !m_entity_manager.GetIsAlive( entity ) )
+            return;
+
+        if ( !use_sweep_destroy )
+            Erase( entity );
+
+        m_entity_manager.Destroy( entity, use_sweep_destroy );
+    }
+
+    void AcheronArchetypeContext::Destroy( std::span<const AcheronUUID> entities, const bool use_sweep_destroy ) {
+        for ( const auto entity : entities )
+            Destroy( entity, use_sweep_destroy );
+    }
+
+    void AcheronArchetypeContext::Sweep( ) {
+        ACS_PROFILE_SCOPE( "AcheronArchetypeContext::Sweep" );
+
+        for ( const auto entity : m_entity_manager.GetSweeEntities( ) )
+            Erase( entity );
+
+        m_entity_manager.Sweep( );
+    }
+
+    void AcheronArchetypeContext::Lock( ) {
+        m_lock_count.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    void AcheronArchetypeContext::Unlock( ) {
+        ACS_ASSERT( m_lock_count.load( std::memory_order_relaxed ) > 0, "Archetype context unlocked more than locked." );
+
+        m_lock_count.fetch_sub( 1, std::memory_order_relaxed );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PRIVATE ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    void AcheronArchetypeContext::Place( const AcheronUUID entity ) {
+        ACS_ASSERT( !GetIsLocked( ), "Archetype context structural change while locked by a parallel iteration." );
+
+        const auto index = uint32_t( entity.Value & 0xFFFFFFFF );
+
+        if ( index >= m_locations.size( ) )
+            m_locations.resize( size_t( index ) + 1, Location{ ArchetypeNone, 0 } );
+
+        // A reused index can still own the row of an entity waiting for Sweep.
+        if ( m_locations[ index ].Archetype != ArchetypeNone ) {
+            const auto& location = m_locations[ index ];
+
+            Erase( m_archetypes[ location.Archetype ]->GetEntity( location.Row ) );
+        }
+
+        m_locations[ index ] = Location{ 0, m_archetypes[ 0 ]->Allocate( entity ) };
+    }
+
+    void AcheronArchetypeContext::Erase( const AcheronUUID entity ) {
+        ACS_ASSERT( !GetIsLocked( ), "Archetype context structural change while locked by a parallel iteration." );
+
+        const auto index = uint32_t( entity.Value & 0xFFFFFFFF );
+
+        if ( index >= m_locations.size( ) )
+            return;
+
+        auto& location = m_locations[ index ];
+
+        if ( location.Archetype == ArchetypeNone )
+            return;
+
+        auto& archetype = *m_archetypes[ location.Archetype ];
+
+        if ( archetype.GetEntity( location.Row ) != entity )
+            return;
+
+        const auto moved_entity = archetype.Erase( location.Row, nullptr );
+
+        if ( moved_entity )
+            m_locations[ uint32_t( moved_entity.Value & 0xFFFFFFFF ) ].Row = location.Row;
+
+        location = Location{ ArchetypeNone, 0 };
+    }
+
+    void* AcheronArchetypeContext::Insert( const AcheronUUID entity, const AcheronArchetypeType& type ) {
+        if ( !m_entity_manager.GetIsAlive( entity ) )
+            return nullptr;
+
+        const auto index  = uint32_t( entity.Value & 0xFFFFFFFF );
+        const auto source = m_locations[ index ].Archetype;
+
+        if ( m_archetypes[ source ]->FindColumn( type.Id ) != AcheronArchetype::Missing )
+            return nullptr;
+
+        auto edge = m_add_edges[ source ].find( type.Id );
+
+        if ( edge == m_add_edges[ source ].end( ) ) {
+            auto types = m_archetypes[ source ]->GetTypes( );
+            auto where = std::lower_bound( 
+                types.begin( ), 
+                types.end( ), 
+                type.Id, 
+                []( const AcheronArchetypeType* other, const uint64_t id ) { return other->Id < id; }
+            );
+
+            types.insert( where, &type );
+
+            const auto target = FindArchetype( types );
+
+            edge = m_add_edges[ source ].emplace( type.Id, target ).first;
+
+            m_remove_edges[ target ].emplace( type.Id, source );
+        }
+
+        const auto target = edge->second;
+        const auto row    = Move( entity, target );
+        const auto column = m_archetypes[ target ]->FindColumn( type.Id );
+
+        return m_archetypes[ target ]->GetComponent( column, row );
+    }
+
+    void AcheronArchetypeContext::Extract( const AcheronUUID entity, const AcheronArchetypeType& type ) {
+        if ( !m_entity_manager.GetIsAlive( entity ) )
+            return;
+
+        const auto index  = uint32_t( entity.Value & 0xFFFFFFFF );
+        const auto source = m_locations[ index ].Archetype;
+
+        if ( m_archetypes[ source ]->FindColumn( type.Id ) == AcheronArchetype::Missing )
+            return;
+
+        auto edge = m_remove_edges[ source ].find( type.Id );
+
+        if ( edge == m_remove_edges[ source ].end( ) ) {
+            auto types = m_archetypes[ source ]->GetTypes( );
+
+            std::erase_if( types, [ &type ]( const AcheronArchetypeType* other ) { return other->Id == type.Id; } );
+
+            const auto target = FindArchetype( types );
+
+            edge = m_remove_edges[ source ].emplace( type.Id, target ).first;
+
+            m_add_edges[ target ].emplace( type.Id, source );
+        }
+
+        Move( entity, edge->second );
+    }
+
+    uint32_t AcheronArchetypeContext::Move( const AcheronUUID entity, const uint32_t target ) {
+        ACS_ASSERT( !GetIsLocked( ), "Archetype context structural change while locked by a parallel iteration." );
+
+        auto& location          = m_locations[ uint32_t( entity.Value & 0xFFFFFFFF ) ];
+        auto& source_archetype  = *m_archetypes[ location.Archetype ];
+        auto& target_archetype  = *m_archetypes[ target ];
+        const auto row          = target_archetype.Allocate( entity );
+
+        for ( auto column = uint32_t( 0 ); column < target_archetype.GetColumnCount( ); column++ ) {
+            const auto& type          = target_archetype.GetColumnType( column );
+            const auto source_column  = source_archetype.FindColumn( type.Id );
+
+            if ( source_column != AcheronArchetype::Missing )
+                type.Move( target_archetype.GetComponent( column, row ), source_archetype.GetComponent( source_column, location.Row ) );
+        }
+
+        const auto moved_entity = source_archetype.Erase( location.Row, &target_archetype );
+
+        if ( moved_entity )
+            m_locations[ uint32_t( moved_entity.Value & 0xFFFFFFFF ) ].Row = location.Row;
+
+        location = Location{ target, row };
+
+        return row;
+    }
+
+    uint32_t AcheronArchetypeContext::FindArchetype( const std::vector<const AcheronArchetypeType*>& types ) {
+        auto signature = uint64_t( types.size( ) );
+
+        for ( const auto* type : types )
+            signature ^= type->Id + 0x9E3779B97F4A7C15 + ( signature << 6 ) + ( signature >> 2 );
+
+        auto& bucket = m_signatures[ signature ];
+
+        for ( const auto index : bucket ) {
+            const auto other = m_archetypes[ index ]->GetTypes( );
+            const auto match = std::equal( 
+                other.begin( ), 
+                other.end( ), 
+                types.begin( ), 
+                types.end( ), 
+                []( const AcheronArchetypeType* left, const AcheronArchetypeType* right ) { return left->Id == right->Id; }
+            );
+
+            if ( match )
+                return index;
+        }
+
+        const auto index = uint32_t( m_archetypes.size( ) );
+
+        m_archetypes.emplace_back( std::make_unique<AcheronArchetype>( types ) );
+        m_add_edges.emplace_back( );
+        m_remove_edges.emplace_back( );
+
+        bucket.emplace_back( index );
+
+        return index;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC GET ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    AcheronEntityManager& AcheronArchetypeContext::GetEntityManager( ) {
+        return m_entity_manager;
+    }
+
+    uint32_t AcheronArchetypeContext::GetEntityCount( ) const {
+        return m_entity_manager.GetCount( );
+    }
+
+    bool AcheronArchetypeContext::GetIsAlive( const AcheronUUID entity ) const {
+        return m_entity_manager.GetIsAlive( entity );
+    }
+
+    AcheronJobSystem* AcheronArchetypeContext::GetJobSystem( ) const {
+        return m_job_system;
+    }
+
+    const std::vector<std::unique_ptr<AcheronArchetype>>& AcheronArchetypeContext::GetArchetypes( ) const {
+        return m_archetypes;
+    }
+
+    bool AcheronArchetypeContext::GetIsLocked( ) const {
+        return m_lock_count.load( std::memory_order_relaxed ) > 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PRIVATE GET ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    void* AcheronArchetypeContext::GetComponent( const AcheronUUID entity, const uint64_t id ) const {
+        if ( !m_entity_manager.GetIsAlive( entity ) )
+            return nullptr;
+
+        const auto& location  = m_locations[ uint32_t( entity.Value & 0xFFFFFFFF ) ];
+        const auto& archetype = *m_archetypes[ location.Archetype ];
+        const auto column     = archetype.FindColumn( id );
+
+        if ( column == AcheronArchetype::Missing )
+            return nullptr;
+
+        return archetype.GetComponent( column, location.Row );
+    }
+
+};
@@ -0,0 +1,330 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronArchetype.h"
+
+namespace acs {
+
+    // Standalone archetype engine, not a backend of AcheronContext. Entities
+    // are created, changed and iterated through this context and 
+    // AcheronArchetypeView only, AcheronComponentView, AcheronComponentCache
+    // and AcheronSystem keep working on AcheronContext typed storages.
+    class ACS_API AcheronArchetypeContext final {
+
+        struct Location {
+
+            uint32_t Archetype;
+            uint32_t Row;
+
+        };
+
+    private:
+        AcheronEntityManager m_entity_manager;
+        AcheronJobSystem* m_job_system;
+        std::vector<std::unique_ptr<AcheronArchetype>> m_archetypes;
+        std::vector<std::unordered_map<uint64_t, uint32_t>> m_add_edges;
+        std::vector<std::unordered_map<uint64_t, uint32_t>> m_remove_edges;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> m_signatures;
+        std::vector<Location> m_locations;
+        std::atomic<uint32_t> m_lock_count;
+
+    public:
+        /**
+         * Constructor
+         **/
+        AcheronArchetypeContext( );
+
+        /**
+         * Destructor
+         **/
+        ~AcheronArchetypeContext( ) = default;
+
+        /**
+         * Clear method
+         * @note : Clear entities and all archetypes.
+         **/
+        void Clear( );
+
+        /**
+         * SetJobSystem method
+         * @note : Set the job system used by archetype views parallel 
+         *         iterations, the context don't own it.
+         * @param job_system : Pointer to the job system, nullptr to run on
+         *                     the calling thread.
+         **/
+        void SetJobSystem( AcheronJobSystem* job_system );
+
+        /**
+         * SetReusePolicy method
+         * @note : Set the order destroyed entity indices are reused in.
+         * @param policy : New reuse policy.
+         **/
+        void SetReusePolicy( const AcheronReusePolicies policy );
+
+        /**
+         * Create function
+         * @note : Create an new entity in the empty archetype.
+         * @return Return new entity uuid.
+         **/
+        AcheronUUID Create( );
+
+        /**
+         * Create method
+         * @note : Create count entities in the empty archetype.
+         * @param count : Entity count to create.
+         * @param entities : Span receiving the new entities uuids, must 
+         *                   hold at least count uuids.
+         **/
+        void Create( const uint32_t count, std::span<AcheronUUID> entities );
+
+        /**
+         * Destroy method
+         * @note : Destroy an entity using is uuid, components are destroyed
+         *         immediately or on the next Sweep when sweep destroy is 
+         *         used.
+         * @param entity : Entity uuid.
+         * @param use_sweep_destroy : True to use sweep destroy on the entity.
+         **/
+        void Destroy( const AcheronUUID entity, const bool use_sweep_destroy );
+
+        /**
+         * Destroy method
+         * @note : Destroy a range of entities.
+         * @param entities : Entities uuids to destroy.
+         * @param use_sweep_destroy : True to use sweep destroy on the entities.
+         **/
+        void Destroy( std::span<const AcheronUUID> entities, const bool use_sweep_destroy );
+
+        /**
+         * Sweep method
+         * @note : Destroy the components of entities destroyed with sweep 
+         *         destroy.
+         **/
+        void Sweep( );
+
+        /**
+         * Lock method
+         * @note : Forbid structural changes while a parallel iteration read
+         *         the archetype chunks, checked by ACS_ASSERT.
+         **/
+        void Lock( );
+
+        /**
+         * Unlock method
+         * @note : Release a lock taken with Lock.
+         **/
+        void Unlock( );
+
+    private:
+        /**
+         * Place method
+         * @note : Place a new entity in the empty archetype.
+         * @param entity : Entity uuid.
+         **/
+        void Place( const AcheronUUID entity );
+
+        /**
+         * Erase method
+         * @note : Erase an entity row and destroy its components.
+         * @param entity : Entity uuid.
+         **/
+        void Erase( const AcheronUUID entity );
+
+        /**
+         * Insert function
+         * @note : Move an entity to the archetype with one more component.
+         * @param entity : Entity uuid.
+         * @param type : Added component type.
+         * @return Pointer to the unconstructed component, nullptr when the
+         *         entity is dead or already own the component.
+         **/
+        void* Insert( const AcheronUUID entity, const AcheronArchetypeType& type );
+
+        /**
+         * Extract method
+         * @note : Move an entity to the archetype with one less component,
+         *         the component is destroyed.
+         * @param entity : Entity uuid.
+         * @param type : Removed component type.
+         **/
+        void Extract( const AcheronUUID entity, const AcheronArchetypeType& type );
+
+        /**
+         * Move function
+         * @note : Move an entity row to another archetype, shared 
+         *         components are moved and others destroyed.
+         * @param entity : Entity uuid.
+         * @param target : Target archetype index.
+         * @return Entity row in the target archetype.
+         **/
+        uint32_t Move( const AcheronUUID entity, const uint32_t target );
+
+        /**
+         * FindArchetype function
+         * @note : Find the archetype of a component type set, create it when
+         *         missing.
+         * @param types : Component types sorted by id.
+         * @return Archetype index.
+         **/
+        uint32_t FindArchetype( const std::vector<const AcheronArchetypeType*>& types );
+
+    public:
+        /**
+         * Append template method
+         * @note : Add a component to an entity, the entity is moved to the 
+         *         archetype owning the new component set. Nothing is done 
+         *         when the entity already own the component.
+         * @template CompType : Component type to append.
+         * @param entity : Entity uuid.
+         * @param component : Component instance to emplace.
+         **/
+        template<typename CompType>
+        void Append( const AcheronUUID entity, const CompType& component ) {
+            auto* memory = Insert( entity, AcheronArchetypeType::Get<CompType>( ) );
+
+            if ( memory )
+                new ( memory ) CompType( component );
+        };
+
+        /**
+         * Append template method
+         * @note : Add a component to an entity.
+         * @template CompType : Component type to append.
+         * @param entity : Entity uuid.
+         * @param component : Component instance to move.
+         **/
+        template<typename CompType>
+            requires ( !std::is_lvalue_reference_v<CompType> )
+        void Append( const AcheronUUID entity, CompType&& component ) {
+            auto* memory = Insert( entity, AcheronArchetypeType::Get<CompType>( ) );
+
+            if ( memory )
+                new ( memory ) CompType( std::move( component ) );
+        };
+
+        /**
+         * Remove template method
+         * @note : Remove a components from an entity, the entity is moved 
+         *         once per removed component.
+         * @template CompTypes : Collection of component type to remove.
+         * @param entity : Entity uuid.
+         **/
+        template<typename... CompTypes>
+        void Remove( const AcheronUUID entity ) {
+            ( Extract( entity, AcheronArchetypeType::Get<CompTypes>( ) ), ... );
+        };
+
+    public:
+        /**
+         * GetEntityManager function
+         * @note : Get curent entity manager instance.
+         * @return Reference to current entity manager instance
+         **/
+        AcheronEntityManager& GetEntityManager( );
+
+        /**
+         * GetEntityCount const function
+         * @note : Get actual valid entitiy count.
+         * @return Return the count of valid entity as uint32_t.
+         **/
+        uint32_t GetEntityCount( ) const;
+
+        /**
+         * GetIsAlive function
+         * @note : Check if an entity is alive.
+         * @param entity : Entity uuid to check.
+         * @return True when the entity uuid point to a valid entity.
+         **/
+        bool GetIsAlive( const AcheronUUID entity ) const;
+
+        /**
+         * GetJobSystem const function
+         * @note : Get current job system.
+         * @return Pointer to current job system.
+         **/
+        AcheronJobSystem* GetJobSystem( ) const;
+
+        /**
+         * GetArchetypes const function
+         * @note : Get context archetypes, the first one is the empty 
+         *         archetype.
+         * @return Constant reference to the archetype vector.
+         **/
+        const std::vector<std::unique_ptr<AcheronArchetype>>& GetArchetypes( ) const;
+
+        /**
+         * GetIsLocked const function
+         * @note : Check if a parallel iteration lock the context.
+         * @return True when locked.
+         **/
+        bool GetIsLocked( ) const;
+
+    private:
+        /**
+         * GetComponent const function
+         * @note : Get component for a specific entity.
+         * @param entity : Target entity uuid.
+         * @param id : Component type id.
+         * @return Pointer the component or nullptr if not found.
+         **/
+        void* GetComponent( const AcheronUUID entity, const uint64_t id ) const;
+
+    public:
+        /**
+         * GetComponent template function
+         * @note : Get component for a specific entity.
+         * @template CompType : Component type.
+         * @param entity : Target entity uuid.
+         * @return Pointer the component or nullptr if not found.
+         **/
+        template<typename CompType>
+        auto GetComponent( const AcheronUUID entity ) -> CompType* {
+            return static_cast<CompType*>( GetComponent( entity, AcheronArchetypeType::Get<CompType>( ).Id ) );
+        };
+
+        /**
+         * GetComponent const template function
+         * @note : Get component for a specific entity.
+         * @template CompType : Component type.
+         * @param entity : Target entity uuid.
+         * @return Constant pointer the component or nullptr if not found.
+         **/
+        template<typename CompType>
+        auto GetComponent( const AcheronUUID entity ) const -> const CompType* {
+            return static_cast<const CompType*>( GetComponent( entity, AcheronArchetypeType::Get<CompType>( ).Id ) );
+        };
+
+    };
+
+};
@@ -0,0 +1,278 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronArchetypeViewIterator.h"
+
+namespace acs {
+
+    template<typename... CompTypes>
+    class AcheronArchetypeView final {
+
+        using Match = AcheronArchetypeMatch<CompTypes...>;
+
+        struct Chunk {
+
+            const Match* Target;
+            uint32_t Index;
+            uint32_t Count;
+
+        };
+
+    private:
+        AcheronArchetypeContext& m_context;
+        std::vector<Match> m_matches;
+
+    public:
+        /**
+         * Constructor
+         * @note : Collect the context archetypes owning every view component
+         *         type, archetypes created after the view aren't visited.
+         * @param context : Reference to current archetype context instance.
+         **/
+        AcheronArchetypeView( AcheronArchetypeContext& context )
+            : m_context{ context },
+            m_matches{ }
+        {
+            for ( const auto& archetype : context.GetArchetypes( ) ) {
+                const auto match = Match{ 
+                    archetype.get( ), 
+                    { archetype->FindColumn( AcheronArchetypeType::Get<std::remove_const_t<CompTypes>>( ).Id )... } 
+                };
+
+                if ( std::find( match.Columns.begin( ), match.Columns.end( ), AcheronArchetype::Missing ) == match.Columns.end( ) )
+                    m_matches.emplace_back( match );
+            }
+        };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronArchetypeView( ) = default;
+
+        /**
+         * begin function
+         * @note : Get iterator to the first view iterator.
+         * @return Return view iterator for the first entitiy uuid. 
+         **/
+        auto begin( ) -> AcheronArchetypeViewIterator<CompTypes...> {
+            return { m_matches, 0 };
+        };
+
+        /**
+         * end function
+         * @note : Get iterator to the last view iterator.
+         * @return Return view iterator for the last entitiy uuid.
+         **/
+        auto end( ) -> AcheronArchetypeViewIterator<CompTypes...> {
+            return { m_matches, uint32_t( m_matches.size( ) ) };
+        };
+
+        /**
+         * ParallelEach template method
+         * @note : Call a function for each view entry, chunks are grouped 
+         *         in jobs processed by the context job system and run on 
+         *         the calling thread when no worker is available. The 
+         *         context is locked during the call so the function must 
+         *         not add or remove components, and must only write to the
+         *         components of its own entry.
+         * @template Function : Function type, called with a reference to 
+         *                      the view iterator tuple.
+         * @param function : Function to call for each entry.
+         * @param grain : Minimum entry count per job.
+         **/
+        template<typename Function>
+        void ParallelEach( Function&& function, const uint32_t grain ) {
+            Dispatch( grain, [ &function ]( const Chunk& chunk ) -> void {
+                const auto* archetype = chunk.Target->Archetype;
+                const auto* entities  = archetype->GetEntities( chunk.Index );
+
+                [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                    const auto columns = std::tuple<CompTypes*...>{ 
+                        static_cast<CompTypes*>( archetype->GetColumn( chunk.Index, chunk.Target->Columns[ Indices ] ) )... 
+                    };
+
+                    for ( auto row = uint32_t( 0 ); row < chunk.Count; row++ ) {
+                        auto components = std::make_tuple( entities[ row ], ( std::get<Indices>( columns ) + row )... );
+
+                        function( components );
+                    }
+                }( std::index_sequence_for<CompTypes...>{ } );
+            } );
+        };
+
+        /**
+         * EachBatch template method
+         * @note : Call a function once per archetype chunk, chunk columns 
+         *         are contiguous arrays.
+         * @template Function : Function type, called with the chunk entity
+         *                      span followed by one component span per 
+         *                      view component type.
+         * @param function : Function to call for each chunk.
+         **/
+        template<typename Function>
+        void EachBatch( Function&& function ) {
+            for ( const auto& match : m_matches ) {
+                for ( auto index = uint32_t( 0 ); index < match.Archetype->GetChunkCount( ); index++ ) {
+                    const auto count = match.Archetype->GetChunkEntityCount( index );
+
+                    if ( count == 0 )
+                        break;
+
+                    Batch( function, Chunk{ &match, index, count } );
+                }
+            }
+        };
+
+        /**
+         * ParallelEachBatch template method
+         * @note : Call a function once per archetype chunk, chunks are 
+         *         grouped in jobs following the ParallelEach rules.
+         * @template Function : Function type, called with the chunk entity
+         *                      span followed by one component span per 
+         *                      view component type.
+         * @param function : Function to call for each chunk.
+         * @param grain : Minimum entry count per job.
+         **/
+        template<typename Function>
+        void ParallelEachBatch( Function&& function, const uint32_t grain ) {
+            Dispatch( grain, [ this, &function ]( const Chunk& chunk ) -> void {
+                Batch( function, chunk );
+            } );
+        };
+
+    private:
+        /**
+         * Dispatch template method
+         * @note : Group the non empty view chunks in jobs of at least grain 
+         *         entries processed by the context job system, or on the 
+         *         calling thread when no worker is available. The context 
+         *         is locked during the call.
+         * @template Function : Chunk function type.
+         * @param grain : Minimum entry count per job.
+         * @param function : Chunk function.
+         **/
+        template<typename Function>
+        void Dispatch( const uint32_t grain, Function&& function ) {
+            ACS_ASSERT( grain > 0, "Parallel each grain must be non zero." );
+
+            auto* job_system = m_context.GetJobSystem( );
+            auto chunks      = std::vector<Chunk>{ };
+            auto count       = uint32_t( 0 );
+
+            for ( const auto& match : m_matches ) {
+                for ( auto index = uint32_t( 0 ); index < match.Archetype->GetChunkCount( ); index++ ) {
+                    const auto chunk_count = match.Archetype->GetChunkEntityCount( index );
+
+                    if ( chunk_count == 0 )
+                        break;
+
+                    chunks.emplace_back( Chunk{ &match, index, chunk_count } );
+
+                    count += chunk_count;
+                }
+            }
+
+            if ( count == 0 )
+                return;
+
+            m_context.Lock( );
+
+            if ( !job_system || job_system->GetWorkerCount( ) == 0 || count <= grain || chunks.size( ) == 1 ) {
+                for ( const auto& chunk : chunks )
+                    function( chunk );
+            } else {
+                auto counter = AcheronJobCounter{ };
+                auto start   = size_t( 0 );
+
+                while ( start < chunks.size( ) ) {
+                    auto stop  = start;
+                    auto total = uint32_t( 0 );
+
+                    while ( stop < chunks.size( ) && total < grain )
+                        total += chunks[ stop++ ].Count;
+
+                    job_system->Schedule( [ &function, &chunks, start, stop ]( ) {
+                        for ( auto index = start; index < stop; index++ )
+                            function( chunks[ index ] );
+                    }, &counter );
+
+                    start = stop;
+                }
+
+                job_system->WaitFor( counter );
+            }
+
+            m_context.Unlock( );
+        };
+
+        /**
+         * Batch template method
+         * @note : Call a function with a chunk entity and component spans.
+         * @template Function : Function type.
+         * @param function : Reference to the function to call.
+         * @param chunk : View chunk.
+         **/
+        template<typename Function>
+        void Batch( Function& function, const Chunk& chunk ) {
+            const auto* archetype = chunk.Target->Archetype;
+
+            [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                function( 
+                    std::span<const AcheronUUID>{ archetype->GetEntities( chunk.Index ), chunk.Count },
+                    std::span<CompTypes>{ 
+                        static_cast<CompTypes*>( archetype->GetColumn( chunk.Index, chunk.Target->Columns[ Indices ] ) ), 
+                        chunk.Count 
+                    }... 
+                );
+            }( std::index_sequence_for<CompTypes...>{ } );
+        };
+
+    public:
+        /**
+         * GetCount const function
+         * @note : Get view entry count.
+         * @return Entry count as uint32_t.
+         **/
+        uint32_t GetCount( ) const {
+            auto count = uint32_t( 0 );
+
+            for ( const auto& match : m_matches )
+                count += match.Archetype->GetCount( );
+
+            return count;
+        };
+
+    };
+
+};
@@ -0,0 +1,158 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronArchetypeContext.h"
+
+namespace acs {
+
+    template<typename... CompTypes>
+    struct AcheronArchetypeMatch {
+
+        const AcheronArchetype* Archetype;
+        std::array<uint32_t, sizeof...( CompTypes )> Columns;
+
+    };
+
+    template<typename... CompTypes>
+    class AcheronArchetypeViewIterator final {
+
+    private:
+        const std::vector<AcheronArchetypeMatch<CompTypes...>>& m_matches;
+        std::tuple<CompTypes*...> m_columns;
+        const AcheronUUID* m_entities;
+        uint32_t m_match;
+        uint32_t m_chunk;
+        uint32_t m_row;
+        uint32_t m_count;
+
+    public:
+        /**
+         * Constructor
+         * @param matches : Reference to the view archetype matches.
+         * @param match : Index of the first match to iterate, the match 
+         *                count for the end iterator.
+         **/
+        AcheronArchetypeViewIterator(
+            const std::vector<AcheronArchetypeMatch<CompTypes...>>& matches,
+            const uint32_t match
+        )
+            : m_matches{ matches },
+            m_columns{ },
+            m_entities{ nullptr },
+            m_match{ match },
+            m_chunk{ 0 },
+            m_row{ 0 },
+            m_count{ 0 }
+        { 
+            Seek( );
+        };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronArchetypeViewIterator( ) = default;
+
+    private:
+        /**
+         * Seek method
+         * @note : Move to the first non empty chunk from the current one, 
+         *         archetype rows are dense so an empty chunk end the match.
+         **/
+        void Seek( ) {
+            while ( m_match < m_matches.size( ) ) {
+                const auto& match = m_matches[ m_match ];
+
+                m_count = match.Archetype->GetChunkEntityCount( m_chunk );
+
+                if ( m_count > 0 ) {
+                    m_entities = match.Archetype->GetEntities( m_chunk );
+
+                    [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                        m_columns = std::tuple<CompTypes*...>{ 
+                            static_cast<CompTypes*>( match.Archetype->GetColumn( m_chunk, match.Columns[ Indices ] ) )... 
+                        };
+                    }( std::index_sequence_for<CompTypes...>{ } );
+
+                    return;
+                }
+
+                m_match += 1;
+                m_chunk  = 0;
+            }
+        };
+
+    public:
+        /**
+         * Dereferencing operator 
+         * @note : Access the current iterator view tuple.
+         * @return Tuple to current view iterator entity uuid and components 
+         *         pointers.
+         **/
+        auto operator*( ) -> std::tuple<AcheronUUID, CompTypes*...> {
+            const auto row = m_row;
+
+            return std::apply( [ & ]( CompTypes*... columns ) {
+                return std::make_tuple( m_entities[ row ], ( columns + row )... );
+            }, m_columns );
+        };
+
+        /**
+         * Increment operator
+         * @note : Move to the next view iterator entry.
+         * @return Reference to current view iterator instance.
+         **/
+        AcheronArchetypeViewIterator& operator++( ) {
+            if ( ++m_row == m_count ) {
+                m_row    = 0;
+                m_chunk += 1;
+
+                Seek( );
+            }
+
+            return *this;
+        };
+
+        /**
+         * Check operator
+         * @note : Check if two view iterator are identical.
+         * @param other : The other view iterator instance.
+         * @return True when the two view ierators don't match.
+         **/
+        bool operator!=( const AcheronArchetypeViewIterator& other ) {
+            return m_match != other.m_match || m_chunk != other.m_chunk || m_row != other.m_row;
+        };
+
+    };
+
+};
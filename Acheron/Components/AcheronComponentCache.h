@@ -40,8 +40,15 @@ namespace acs {
 
         using EntityCache = std::vector<AcheronUUID>;
 
+        struct CacheEntry {
+
+            EntityCache Entities;
+            std::vector<uint64_t> Versions;
+
+        };
+
     private:
-        std::unordered_map<AcheronUUID, EntityCache> m_caches;
+        std::unordered_map<AcheronUUID, CacheEntry> m_caches;
 
     public:
         /**
@@ -61,61 +68,217 @@ namespace acs {
          **/
         template<typename... CompTypes>
         const EntityCache& Get( AcheronComponentManager& component_manager ) {
-            const auto component_uuid = AcheronUUID::Make<CompTypes...>( );
-            auto& entry = m_caches[ component_uuid ];
+            constexpr auto component_uuid = AcheronUUID::Make<CompTypes...>( );
+            auto iterator = m_caches.find( component_uuid );
+
+            // Lookup don't modify the map so prewarmed caches can be read 
+            // from concurrent systems.
+            if ( iterator == m_caches.end( ) ) [[unlikely]]
+                iterator = m_caches.emplace( component_uuid, CacheEntry{ } ).first;
+
+            // Views of the same components in another order share the entry,
+            // versions are stored in type hash order.
+            constexpr auto slots = GetVersionSlots<CompTypes...>( );
+            auto& entry     = iterator->second;
+            auto versions   = std::array<uint64_t, sizeof...( CompTypes )>{ };
+            auto version_id = size_t( 0 );
+
+            ( [ & ]( ) -> void {
+                versions[ slots[ version_id++ ] ] = component_manager.GetComponentVersion<CompTypes>( );
+            }( ), ... );
 
-            if ( component_manager.GetComponentAreDirty<CompTypes...>( ) ) {
-                entry = ComputeCache( component_manager );
+            if ( entry.Versions.size( ) != versions.size( ) ) {
+                entry.Entities = ComputeCache<CompTypes...>( component_manager );
+                entry.Versions.assign( versions.begin( ), versions.end( ) );
+            } else if ( !std::equal( versions.begin( ), versions.end( ), entry.Versions.begin( ) ) ) {
+                if ( !UpdateCache<CompTypes...>( component_manager, entry ) )
+                    entry.Entities = ComputeCache<CompTypes...>( component_manager );
 
-                component_manager.UnMarkDirty<CompTypes...>( );
+                entry.Versions.assign( versions.begin( ), versions.end( ) );
             }
 
-            return entry;
+            return entry.Entities;
         };
 
     private:
+        /**
+         * GetVersionSlots static template function
+         * @note : Get the cache entry version index of each component type,
+         *         types are ranked by type hash so the slots don't depend 
+         *         on the view component order.
+         * @template CompTypes : Variadic template of all component in the view.
+         * @return Version index for each component type.
+         **/
+        template<typename... CompTypes>
+        static constexpr auto GetVersionSlots( ) -> std::array<size_t, sizeof...( CompTypes )> {
+            constexpr auto hashes = std::array<uint64_t, sizeof...( CompTypes )>{ GetTypeHash<CompTypes>( )... };
+            auto slots = std::array<size_t, sizeof...( CompTypes )>{ };
+
+            for ( auto index = size_t( 0 ); index < hashes.size( ); index++ ) {
+                for ( auto other = size_t( 0 ); other < hashes.size( ); other++ ) {
+                    if ( hashes[ other ] < hashes[ index ] || ( hashes[ other ] == hashes[ index ] && other < index ) )
+                        slots[ index ] += 1;
+                }
+            }
+
+            return slots;
+        };
+
+        /**
+         * UpdateCache template function
+         * @note : Apply storages changes newer than the cache versions to an
+         *         entity uuid's cache, changed entities are removed from the
+         *         cache then added back when they own all the view components.
+         * @template CompTypes : Variadic template of all component in the view.
+         * @param component_manager : Reference to component manager instance.
+         * @param entry : Reference to the cache entry to update.
+         * @return False when the cache must be rebuilt, the change logs
+         *         don't reach the cache versions or are bigger than the cache.
+         **/
+        template<typename... CompTypes>
+        bool UpdateCache( AcheronComponentManager& component_manager, CacheEntry& entry ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentCache::UpdateCache" );
+
+            constexpr auto slots = GetVersionSlots<CompTypes...>( );
+            auto& entity_cache = entry.Entities;
+            auto version_id    = size_t( 0 );
+            auto is_outdated   = false;
+            auto change_count  = size_t( 0 );
+            auto change_ranges = std::array<std::span<const AcheronComponentChange>, sizeof...( CompTypes )>{ };
+
+            ( [ & ]( ) -> void {
+                const auto& storage = component_manager.GetStorage<CompTypes>( );
+                const auto version  = entry.Versions[ slots[ version_id ] ];
+                const auto& storage_changes = storage.GetChanges( );
+
+                if ( version < storage.GetChangesVersion( ) )
+                    is_outdated = true;
+                else {
+                    const auto first = std::upper_bound( 
+                        storage_changes.begin( ), storage_changes.end( ), version,
+                        []( const uint64_t value, const AcheronComponentChange& change ) -> bool {
+                            return value < change.Version;
+                        }
+                    );
+
+                    change_ranges[ version_id ] = std::span<const AcheronComponentChange>{ first, storage_changes.end( ) };
+                    change_count += change_ranges[ version_id ].size( );
+                }
+
+                version_id += 1;
+            }( ), ... );
+
+            if ( is_outdated || change_count > entity_cache.size( ) )
+                return false;
+
+            auto changes = EntityCache{ };
+
+            changes.reserve( change_count );
+
+            for ( const auto& range : change_ranges ) {
+                for ( const auto& change : range )
+                    changes.emplace_back( change.Entity );
+            }
+
+            std::sort( changes.begin( ), changes.end( ) );
+            changes.erase( std::unique( changes.begin( ), changes.end( ) ), changes.end( ) );
+
+            auto temp_cache = EntityCache{ };
+            auto iterator   = entity_cache.cbegin( );
+
+            temp_cache.reserve( entity_cache.size( ) + changes.size( ) );
+
+            for ( const auto entity : changes ) {
+                while ( iterator != entity_cache.cend( ) && *iterator < entity )
+                    temp_cache.emplace_back( *iterator++ );
+
+                if ( iterator != entity_cache.cend( ) && *iterator == entity )
+                    ++iterator;
+
+                if ( ( component_manager.GetStorage<CompTypes>( ).Contains( entity ) && ... ) )
+                    temp_cache.emplace_back( entity );
+            }
+
+            temp_cache.insert( temp_cache.end( ), iterator, entity_cache.cend( ) );
+
+            std::swap( entity_cache, temp_cache );
+
+            return true;
+        };
+
         /**
          * ComputeCache template function
-         * @note : Compute actual entity uuid's cache for view access.
+         * @note : Compute actual entity uuid's cache for view access, sorted
+         *         storages are intersected and sparse storages are used as
+         *         filters so the cache is always sorted.
          * @template CompTypes : Variadic template of all component in the view.
          * @param component_manager : Reference to component manager instance.
          * @return Return acutal entity uuid's cache vector.
          **/
         template<typename... CompTypes>
         EntityCache ComputeCache( AcheronComponentManager& component_manager ) {
-            auto lists = std::vector<const EntityCache*>( 
-                &component_manager.GetComponentEntities<CompTypes>( )...
-            );
+            ACS_PROFILE_SCOPE( "AcheronComponentCache::ComputeCache" );
+
+            auto lists        = std::vector<const EntityCache*>{ };
+            auto sparse_lists = std::vector<const EntityCache*>{ };
+
+            ( [ & ]( ) -> void {
+                const auto* entities = &component_manager.GetComponentEntities<CompTypes>( );
+
+                if constexpr ( AcheronComponentStorageOf<CompTypes>::IsSorted )
+                    lists.emplace_back( entities );
+                else
+                    sparse_lists.emplace_back( entities );
+            }( ), ... );
 
-            if ( lists.empty( ) )
+            if ( lists.empty( ) && sparse_lists.empty( ) )
                 return { };
 
-            auto lists_start = lists.begin( );
-            auto lists_stop  = lists.end( );
-            auto sort_algo   = []( const EntityCache* a, const EntityCache* b ) -> bool {
+            auto sort_algo = []( const EntityCache* a, const EntityCache* b ) -> bool {
                 return a->size( ) < b->size( );
             };
-            std::sort( lists_start, lists_stop, sort_algo );
+            auto entity_cache = EntityCache{ };
 
-            auto entity_cache  = *lists.front( );
-            auto temp_cache    = EntityCache{ };
-            auto temp_capacity = entity_cache.size( );
+            if ( !lists.empty( ) ) {
+                std::sort( lists.begin( ), lists.end( ), sort_algo );
 
-            temp_cache.reserve( temp_capacity );
+                entity_cache = *lists.front( );
 
-            for ( auto index = 1; index < lists.size( ); index++ ) {
-                temp_cache.clear( );
+                auto temp_cache    = EntityCache{ };
+                auto temp_capacity = entity_cache.size( );
 
-                std::set_intersection(
-                    entity_cache.begin( ), entity_cache.end( ),
-                    lists[ index ]->begin( ), lists[ index ]->end( ),
-                    std::back_inserter( temp_cache )
-                );
+                temp_cache.reserve( temp_capacity );
 
-                std::swap( entity_cache, temp_cache );
+                for ( auto index = size_t( 1 ); index < lists.size( ); index++ ) {
+                    temp_cache.clear( );
+
+                    std::set_intersection(
+                        entity_cache.begin( ), entity_cache.end( ),
+                        lists[ index ]->begin( ), lists[ index ]->end( ),
+                        std::back_inserter( temp_cache )
+                    );
+
+                    std::swap( entity_cache, temp_cache );
+                }
+            } else {
+                const auto smallest = std::min_element( sparse_lists.begin( ), sparse_lists.end( ), sort_algo );
+
+                entity_cache = **smallest;
+
+                std::sort( entity_cache.begin( ), entity_cache.end( ) );
             }
 
-            return std::move( entity_cache );
+            ( [ & ]( ) -> void {
+                if constexpr ( !AcheronComponentStorageOf<CompTypes>::IsSorted ) {
+                    const auto& storage = component_manager.GetStorage<CompTypes>( );
+
+                    std::erase_if( entity_cache, [ & ]( const AcheronUUID entity ) -> bool {
+                        return !storage.Contains( entity );
+                    } );
+                }
+            }( ), ... );
+
+            return entity_cache;
         };
 
     };
@@ -0,0 +1,377 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once 
+
+#include "AcheronComponentFieldStorage.h"
+
+namespace acs {
+
+    template<typename CompType>
+    class AcheronComponentStorage<CompType, ACS_Storage_Empty> final
+        : public AcheronComponentStorageBase
+    {
+
+        static_assert( std::is_empty_v<CompType>, "ACS_Storage_Empty is only for empty component types." );
+
+    public:
+        static constexpr bool IsSorted = true;
+
+        /**
+         * Constructor
+         * @param storage_capacity : Target default component capacity ( used 
+         *                           so if resize before the storage init, init
+         *                           with resize capacity ).
+         **/
+        AcheronComponentStorage( const uint32_t storage_capacity )
+            : AcheronComponentStorageBase{ }
+        {
+            m_entities.reserve( acs::GetStorageCapacity( storage_capacity ) );
+        };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronComponentStorage( ) override = default;
+
+        /**
+         * Resize method
+         * @note : Resize the component storage to target capacity.
+         * @param capacity : Target new storage capacity.
+         **/
+        void Resize( const uint32_t capacity ) override {
+            const auto current_capacity = uint32_t( m_entities.capacity( ) );
+
+            m_entities.clear( );
+
+            if ( current_capacity < capacity )
+                Reallocate( capacity );
+            else
+                Reallocate( uint32_t( acs::GetStorageCapacity( capacity ) ) );
+
+            IncrementVersion( );
+            DropChanges( );
+        };
+
+        /**
+         * Clear method
+         * @note : Clear all components and reset to defaut capacity if specified.
+         * @param reset_capacity : True to reset the capacity to default.
+         **/
+        void Clear( const bool reset_capacity ) override {
+            m_entities.clear( );
+
+            IncrementVersion( );
+            DropChanges( );
+
+            if ( !reset_capacity )
+                return;
+
+            Reallocate( acs::StorageSize );
+        };
+
+        /**
+         * Append method
+         * @note : Mark an entity as owning the component, the instance 
+         *         isn't stored.
+         * @param entity : Component owning entity.
+         * @param component : Unused component instance.
+         **/
+        void Append( const AcheronUUID entity, CompType&& ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Empty>::Append" );
+
+            if ( m_entities.size( ) == m_entities.capacity( ) )
+                Reserve( m_entities.capacity( ) + 1 );
+
+            const auto iterator = std::lower_bound( m_entities.cbegin( ), m_entities.cend( ), entity );
+
+            if ( iterator != m_entities.cend( ) && *iterator == entity )
+                return;
+
+            m_entities.insert( iterator, entity );
+
+            IncrementVersion( );
+            LogChange( entity );
+        };
+
+        /**
+         * AppendRange method
+         * @note : Mark a range of entities as owning the component with a 
+         *         single sorted merge and a single version increment.
+         * @param entities : Entities uuids.
+         * @param components : Unused component instances, one per entity.
+         **/
+        void AppendRange( std::span<const AcheronUUID> entities, std::span<CompType> components ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Empty>::AppendRange" );
+
+            ACS_ASSERT( entities.size( ) == components.size( ), "Component range size must match entity range size." );
+
+            if ( entities.empty( ) )
+                return;
+
+            if ( !GetIsSortedUnique( entities ) ) {
+                auto sorted_entities = std::vector<AcheronUUID>( entities.begin( ), entities.end( ) );
+
+                std::sort( sorted_entities.begin( ), sorted_entities.end( ) );
+                sorted_entities.erase( std::unique( sorted_entities.begin( ), sorted_entities.end( ) ), sorted_entities.end( ) );
+
+                AppendRange( sorted_entities, components.first( sorted_entities.size( ) ) );
+
+                return;
+            }
+
+            const auto count     = m_entities.size( ) + entities.size( );
+            const auto is_logged = BeginAppendRange( entities.size( ), count );
+            const auto version   = m_version + 1;
+
+            if ( count > m_entities.capacity( ) )
+                Reserve( count );
+
+            if ( m_entities.empty( ) || m_entities.back( ) < entities.front( ) ) {
+                m_entities.insert( m_entities.end( ), entities.begin( ), entities.end( ) );
+
+                if ( is_logged ) {
+                    for ( const auto entity : entities )
+                        m_changes.emplace_back( version, entity );
+                }
+
+                EndAppendRange( is_logged );
+
+                return;
+            }
+
+            auto temp_entities = std::vector<AcheronUUID>{ };
+
+            temp_entities.reserve( m_entities.capacity( ) );
+
+            std::set_union( 
+                m_entities.begin( ), m_entities.end( ), 
+                entities.begin( ), entities.end( ), 
+                std::back_inserter( temp_entities ) 
+            );
+
+            if ( temp_entities.size( ) == m_entities.size( ) )
+                return;
+
+            if ( is_logged ) {
+                std::set_difference( 
+                    entities.begin( ), entities.end( ), 
+                    m_entities.begin( ), m_entities.end( ), 
+                    ChangeInserter{ m_changes, version } 
+                );
+            }
+
+            m_entities.swap( temp_entities );
+
+            EndAppendRange( is_logged );
+        };
+
+        /**
+         * Remove method
+         * @note : Remove the component from an entity.
+         * @param entity : Component owning entity.
+         **/
+        void Remove( const AcheronUUID entity ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Empty>::Remove" );
+
+            const auto iterator = std::lower_bound( m_entities.cbegin( ), m_entities.cend( ), entity );
+
+            if ( iterator == m_entities.cend( ) || *iterator != entity )
+                return;
+
+            m_entities.erase( iterator );
+
+            IncrementVersion( );
+            LogChange( entity );
+        };
+
+        /**
+         * RemoveRange method
+         * @note : Remove the component from a range of entities filtering 
+         *         the entity list in one pass with a single version 
+         *         increment, unsorted ranges are sorted first.
+         * @param entities : Entities uuids.
+         **/
+        void RemoveRange( std::span<const AcheronUUID> entities ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Empty>::RemoveRange" );
+
+            if ( entities.empty( ) || m_entities.empty( ) )
+                return;
+
+            if ( !GetIsSortedUnique( entities ) ) {
+                auto sorted_entities = std::vector<AcheronUUID>( entities.begin( ), entities.end( ) );
+
+                std::sort( sorted_entities.begin( ), sorted_entities.end( ) );
+                sorted_entities.erase( std::unique( sorted_entities.begin( ), sorted_entities.end( ) ), sorted_entities.end( ) );
+
+                RemoveRange( sorted_entities );
+
+                return;
+            }
+
+            if ( entities.back( ) < m_entities.front( ) || m_entities.back( ) < entities.front( ) )
+                return;
+
+            const auto version = BeginRemoveRange( entities.size( ) );
+            const auto first   = std::lower_bound( m_entities.begin( ), m_entities.end( ), entities.front( ) );
+            auto entity_index  = size_t( 0 );
+            auto change_count  = m_changes.size( );
+
+            const auto last = std::remove_if( first, m_entities.end( ), [ & ]( const AcheronUUID entity ) -> bool {
+                while ( entity_index < entities.size( ) && entities[ entity_index ] < entity )
+                    entity_index += 1;
+
+                if ( entity_index == entities.size( ) || entities[ entity_index ] != entity )
+                    return false;
+
+                m_changes.emplace_back( version, entity );
+
+                return true;
+            } );
+
+            if ( m_changes.size( ) == change_count )
+                return;
+
+            m_entities.erase( last, m_entities.end( ) );
+
+            EndRemoveRange( );
+        };
+
+        /**
+         * Sweep method
+         * @note : Destroy component of the defered entity destruction vector.
+         * @param entities : Swept entities uuids sorted ascending without
+         *                   duplicate.
+         **/
+        void Sweep( std::span<const AcheronUUID> entities ) override {
+            RemoveRange( entities );
+        };
+
+    private:
+        /**
+         * ChangeInserter struct
+         * @note : Output iterator logging appended entities at a version.
+         **/
+        struct ChangeInserter {
+
+            using difference_type = std::ptrdiff_t;
+
+            std::vector<AcheronComponentChange>* Changes;
+            uint64_t Version;
+
+            ChangeInserter( std::vector<AcheronComponentChange>& changes, const uint64_t version )
+                : Changes{ &changes },
+                Version{ version }
+            { };
+
+            ChangeInserter& operator=( const AcheronUUID entity ) {
+                Changes->emplace_back( Version, entity );
+
+                return *this;
+            };
+
+            ChangeInserter& operator*( ) { return *this; };
+            ChangeInserter& operator++( ) { return *this; };
+            ChangeInserter operator++( int ) { return *this; };
+
+        };
+
+        /**
+         * Reallocate method
+         * @note : Reallocate the entity vector to a capacity.
+         * @param capacity : New storage capacity.
+         **/
+        void Reallocate( const uint32_t capacity ) {
+            auto temp_entities = std::vector<AcheronUUID>{ };
+
+            temp_entities.reserve( size_t( capacity ) );
+
+            m_entities.swap( temp_entities );
+        };
+
+        /**
+         * Reserve method
+         * @note : Grow the entity vector to hold at least count entities 
+         *         following the sorted storage growth policy.
+         * @param count : Minimum entity count to hold.
+         **/
+        void Reserve( const size_t count ) {
+            m_entities.reserve( GetGrowthCapacity( count ) );
+        };
+
+    public:
+        /**
+         * Contains const function
+         * @note : Get if an entity own the component.
+         * @param entity : Entity uuid.
+         * @return True when the entity own the component.
+         **/
+        bool Contains( const AcheronUUID entity ) const {
+            return std::binary_search( m_entities.begin( ), m_entities.end( ), entity );
+        };
+
+        /**
+         * Get function
+         * @note : Get the component instance for an entity.
+         * @param entity : Entity uuid.
+         * @return Constant pointer to the shared instance or nullptr when
+         *         not found.
+         **/
+        auto Get( const AcheronUUID entity ) const -> const CompType* {
+            return Contains( entity ) ? &AcheronEmptyInstance<CompType> : nullptr;
+        };
+
+        /**
+         * Seek function
+         * @note : Get the component instance for an entity searching 
+         *         forward from a cursor, used for lock-step iteration over
+         *         sorted entity lists.
+         * @param entity : Entity uuid, must not be lower than the entity 
+         *                 at cursor.
+         * @param cursor : Reference to the storage cursor, updated to the
+         *                 entity lower bound index.
+         * @return Constant pointer to the shared instance or nullptr when
+         *         not found.
+         **/
+        auto Seek( const AcheronUUID entity, uint32_t& cursor ) const -> const CompType* {
+            cursor = FindEntityIndexFrom( entity, cursor );
+
+            if ( cursor < m_entities.size( ) && m_entities[ cursor ] == entity )
+                return &AcheronEmptyInstance<CompType>;
+
+            return nullptr;
+        };
+
+    };
+
+};
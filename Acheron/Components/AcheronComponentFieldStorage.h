@@ -0,0 +1,552 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once 
+
+#include "AcheronComponentSparseStorage.h"
+#include "AcheronComponentLayout.h"
+
+namespace acs {
+
+    template<typename CompType>
+    class AcheronComponentStorage<CompType, ACS_Storage_Fields> final
+        : public AcheronComponentStorageBase
+    {
+
+        using Fields = AcheronComponentFields<CompType>;
+
+        using Columns = decltype( [ ]<size_t... Indices>( std::index_sequence<Indices...> ) {
+            return std::tuple<std::vector<typename Fields::template Field<Indices>>...>{ };
+        }( std::make_index_sequence<Fields::Count>{ } ) );
+
+    public:
+        static constexpr bool IsSorted = true;
+
+    private:
+        Columns m_fields;
+
+    public:
+        /**
+         * Constructor
+         * @param storage_capacity : Target default component capacity ( used 
+         *                           so if resize before the storage init, init
+         *                           with resize capacity ).
+         **/
+        AcheronComponentStorage( const uint32_t storage_capacity )
+            : AcheronComponentStorageBase{ },
+            m_fields{ }
+        {
+            Reserve( acs::GetStorageCapacity( storage_capacity ) );
+        };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronComponentStorage( ) override = default;
+
+        /**
+         * Resize method
+         * @note : Resize the component storage to target capacity.
+         * @param capacity : Target new storage capacity.
+         **/
+        void Resize( const uint32_t capacity ) override {
+            const auto current_capacity = uint32_t( m_entities.capacity( ) );
+
+            m_entities.clear( );
+
+            EachField( [ ]( auto& field ) -> void { field.clear( ); } );
+
+            if ( current_capacity < capacity )
+                Reallocate( capacity );
+            else {
+                const auto target_capacity = uint32_t( acs::GetStorageCapacity( capacity ) );
+
+                Reallocate( target_capacity );
+            }
+
+            IncrementVersion( );
+            DropChanges( );
+        };
+
+        /**
+         * Clear method
+         * @note : Clear all components and reset to defaut capacity if specified.
+         * @param reset_capacity : True to reset the capacity to default.
+         **/
+        void Clear( const bool reset_capacity ) override {
+            m_entities.clear( );
+
+            EachField( [ ]( auto& field ) -> void { field.clear( ); } );
+
+            IncrementVersion( );
+            DropChanges( );
+
+            if ( !reset_capacity )
+                return;
+
+            Reallocate( acs::StorageSize );
+        };
+
+        /**
+         * Append method
+         * @note : Append a new component for the specified entity, each 
+         *         field is inserted in its own array.
+         * @param entity : Component owning entity.
+         * @param component : New component instance to append.
+         **/
+        void Append( const AcheronUUID entity, CompType&& component ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Fields>::Append" );
+
+            if ( m_entities.size( ) == m_entities.capacity( ) )
+                Reserve( m_entities.capacity( ) + 1 );
+
+            auto iterator = std::vector<AcheronUUID>::const_iterator( );
+            auto index    = size_t( 0 );
+
+            if ( FindEntityIndex( entity, iterator, index ) )
+                return;
+
+            m_entities.insert( iterator, entity );
+
+            EachField( [ & ]( auto& field, const auto member ) -> void {
+                field.insert( field.begin( ) + index, std::move( component.*member ) );
+            } );
+
+            IncrementVersion( );
+            LogChange( entity );
+        };
+
+        /**
+         * AppendRange method
+         * @note : Append components for a range of entities with a single 
+         *         sorted merge and a single version increment, entities 
+         *         that already own a component are skipped. Unsorted ranges
+         *         are sorted first, the first duplicate is kept.
+         * @param entities : Entities uuids.
+         * @param components : Component instances to move, one per entity.
+         **/
+        void AppendRange( std::span<const AcheronUUID> entities, std::span<CompType> components ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Fields>::AppendRange" );
+
+            ACS_ASSERT( entities.size( ) == components.size( ), "Component range size must match entity range size." );
+
+            if ( entities.empty( ) )
+                return;
+
+            if ( !GetIsSortedUnique( entities ) ) {
+                auto order = std::vector<uint32_t>( entities.size( ) );
+
+                std::iota( order.begin( ), order.end( ), 0 );
+                std::stable_sort( order.begin( ), order.end( ), [ & ]( const uint32_t a, const uint32_t b ) -> bool {
+                    return entities[ a ] < entities[ b ];
+                } );
+
+                auto sorted_entities   = std::vector<AcheronUUID>{ };
+                auto sorted_components = std::vector<CompType>{ };
+
+                sorted_entities.reserve( order.size( ) );
+                sorted_components.reserve( order.size( ) );
+
+                for ( const auto index : order ) {
+                    if ( !sorted_entities.empty( ) && sorted_entities.back( ) == entities[ index ] )
+                        continue;
+
+                    sorted_entities.emplace_back( entities[ index ] );
+                    sorted_components.emplace_back( std::move( components[ index ] ) );
+                }
+
+                AppendRange( sorted_entities, sorted_components );
+
+                return;
+            }
+
+            const auto count     = m_entities.size( ) + entities.size( );
+            const auto is_logged = BeginAppendRange( entities.size( ), count );
+            const auto version   = m_version + 1;
+
+            if ( count > m_entities.capacity( ) )
+                Reserve( count );
+
+            if ( m_entities.empty( ) || m_entities.back( ) < entities.front( ) ) {
+                m_entities.insert( m_entities.end( ), entities.begin( ), entities.end( ) );
+
+                EachField( [ & ]( auto& field, const auto member ) -> void {
+                    for ( auto& component : components )
+                        field.emplace_back( std::move( component.*member ) );
+                } );
+
+                if ( is_logged ) {
+                    for ( const auto entity : entities )
+                        m_changes.emplace_back( version, entity );
+                }
+
+                EndAppendRange( is_logged );
+
+                return;
+            }
+
+            // Merge the entities first, sources keep the old index or the 
+            // new index with NewSource set so each field is merged alone.
+            constexpr auto NewSource = uint32_t( 1 ) << 31;
+
+            auto temp_entities = std::vector<AcheronUUID>{ };
+            auto sources       = std::vector<uint32_t>{ };
+            auto old_index     = size_t( 0 );
+            auto new_index     = size_t( 0 );
+
+            temp_entities.reserve( m_entities.capacity( ) );
+            sources.reserve( count );
+
+            while ( old_index < m_entities.size( ) || new_index < entities.size( ) ) {
+                const auto is_old = new_index == entities.size( ) || ( old_index < m_entities.size( ) && m_entities[ old_index ] <= entities[ new_index ] );
+
+                if ( is_old ) {
+                    if ( new_index < entities.size( ) && m_entities[ old_index ] == entities[ new_index ] )
+                        new_index += 1;
+
+                    temp_entities.emplace_back( m_entities[ old_index ] );
+                    sources.emplace_back( uint32_t( old_index ) );
+
+                    old_index += 1;
+                } else {
+                    temp_entities.emplace_back( entities[ new_index ] );
+                    sources.emplace_back( uint32_t( new_index ) | NewSource );
+
+                    if ( is_logged )
+                        m_changes.emplace_back( version, entities[ new_index ] );
+
+                    new_index += 1;
+                }
+            }
+
+            if ( temp_entities.size( ) == m_entities.size( ) )
+                return;
+
+            m_entities.swap( temp_entities );
+
+            EachField( [ & ]( auto& field, const auto member ) -> void {
+                auto temp_field = std::remove_reference_t<decltype( field )>{ };
+
+                temp_field.reserve( m_entities.capacity( ) );
+
+                for ( const auto source : sources ) {
+                    if ( source & NewSource )
+                        temp_field.emplace_back( std::move( components[ source & ~NewSource ].*member ) );
+                    else
+                        temp_field.emplace_back( std::move( field[ source ] ) );
+                }
+
+                field.swap( temp_field );
+            } );
+
+            EndAppendRange( is_logged );
+        };
+
+        /**
+         * Remove method
+         * @note : Remove a component for the specified entity.
+         * @param entity : Component owning entity.
+         **/
+        void Remove( const AcheronUUID entity ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Fields>::Remove" );
+
+            auto iterator = std::vector<AcheronUUID>::const_iterator( );
+            auto index    = size_t( 0 );
+
+            if ( !FindEntityIndex( entity, iterator, index ) )
+                return;
+
+            m_entities.erase( iterator );
+
+            EachField( [ index ]( auto& field ) -> void {
+                field.erase( field.begin( ) + index );
+            } );
+
+            IncrementVersion( );
+            LogChange( entity );
+        };
+
+        /**
+         * RemoveRange method
+         * @note : Remove components for a range of entities, the removed 
+         *         rows are found on the entity list then each field is 
+         *         compacted in one pass from the first removed row. 
+         *         Unsorted ranges are sorted first.
+         * @param entities : Entities uuids.
+         **/
+        void RemoveRange( std::span<const AcheronUUID> entities ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Fields>::RemoveRange" );
+
+            if ( entities.empty( ) || m_entities.empty( ) )
+                return;
+
+            if ( !GetIsSortedUnique( entities ) ) {
+                auto sorted_entities = std::vector<AcheronUUID>( entities.begin( ), entities.end( ) );
+
+                std::sort( sorted_entities.begin( ), sorted_entities.end( ) );
+                sorted_entities.erase( std::unique( sorted_entities.begin( ), sorted_entities.end( ) ), sorted_entities.end( ) );
+
+                RemoveRange( sorted_entities );
+
+                return;
+            }
+
+            if ( entities.back( ) < m_entities.front( ) || m_entities.back( ) < entities.front( ) )
+                return;
+
+            const auto version = BeginRemoveRange( entities.size( ) );
+            auto removed       = std::vector<uint32_t>{ };
+            auto cursor        = uint32_t( 0 );
+
+            for ( const auto entity : entities ) {
+                cursor = FindEntityIndexFrom( entity, cursor );
+
+                if ( cursor == m_entities.size( ) )
+                    break;
+
+                if ( m_entities[ cursor ] == entity ) {
+                    removed.emplace_back( cursor );
+                    m_changes.emplace_back( version, entity );
+                }
+            }
+
+            if ( removed.empty( ) )
+                return;
+
+            const auto compact = [ & ]( auto& values ) -> void {
+                auto write_index = size_t( removed.front( ) );
+                auto removed_index = size_t( 0 );
+
+                for ( auto read_index = write_index; read_index < values.size( ); read_index++ ) {
+                    if ( removed_index < removed.size( ) && removed[ removed_index ] == read_index ) {
+                        removed_index += 1;
+
+                        continue;
+                    }
+
+                    values[ write_index++ ] = std::move( values[ read_index ] );
+                }
+
+                values.erase( values.begin( ) + write_index, values.end( ) );
+            };
+
+            compact( m_entities );
+            EachField( compact );
+
+            EndRemoveRange( );
+        };
+
+        /**
+         * Sweep method
+         * @note : Destroy component of the defered entity destruction vector.
+         * @param entities : Swept entities uuids sorted ascending without
+         *                   duplicate.
+         **/
+        void Sweep( std::span<const AcheronUUID> entities ) override {
+            RemoveRange( entities );
+        };
+
+    private:
+        /**
+         * EachField template method
+         * @note : Call a function for each field array, with the field 
+         *         member pointer when the function accept it.
+         * @template Function : Function type.
+         * @param function : Function to call.
+         **/
+        template<typename Function>
+        void EachField( Function&& function ) {
+            [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                ( [ & ]( ) -> void {
+                    auto& field = std::get<Indices>( m_fields );
+
+                    if constexpr ( std::is_invocable_v<Function&, decltype( field ), decltype( std::get<Indices>( Fields::Members ) )> )
+                        function( field, std::get<Indices>( Fields::Members ) );
+                    else
+                        function( field );
+                }( ), ... );
+            }( std::make_index_sequence<Fields::Count>{ } );
+        };
+
+        /**
+         * Reallocate method
+         * @note : Reallocate the entity and field arrays to a capacity.
+         * @param capacity : New storage capacity.
+         **/
+        void Reallocate( const uint32_t capacity ) {
+            auto temp_entities = std::vector<AcheronUUID>{ };
+
+            temp_entities.reserve( size_t( capacity ) );
+
+            m_entities.swap( temp_entities );
+
+            EachField( [ capacity ]( auto& field ) -> void {
+                auto temp_field = std::remove_reference_t<decltype( field )>{ };
+
+                temp_field.reserve( size_t( capacity ) );
+
+                field.swap( temp_field );
+            } );
+        };
+
+        /**
+         * Reserve method
+         * @note : Grow the entity and field arrays to hold at least count 
+         *         components following the sorted storage growth policy.
+         * @param count : Minimum component count to hold.
+         **/
+        void Reserve( const size_t count ) {
+            const auto capacity = GetGrowthCapacity( count );
+
+            m_entities.reserve( capacity );
+
+            EachField( [ capacity ]( auto& field ) -> void { field.reserve( capacity ); } );
+        };
+
+    public:
+        /**
+         * GetField template const function
+         * @note : Get a field array, ordered like the entity vector.
+         * @template Member : Member pointer declared in the component 
+         *                    traits Fields.
+         * @return Constant reference to the field vector.
+         **/
+        template<auto Member>
+        const auto& GetField( ) const {
+            constexpr auto index = Fields::template IndexOf<Member>( );
+
+            static_assert( index < Fields::Count, "Member isn't a field of the component traits." );
+
+            return std::get<index>( m_fields );
+        };
+
+        /**
+         * Contains const function
+         * @note : Get if an entity own a component instance.
+         * @param entity : Entity uuid.
+         * @return True when the entity own a component instance.
+         **/
+        bool Contains( const AcheronUUID entity ) const {
+            auto iterator = std::vector<AcheronUUID>::const_iterator( );
+            auto index    = size_t( 0 );
+
+            return FindEntityIndex( entity, iterator, index );
+        };
+
+        /**
+         * Get function
+         * @note : Get the component fields for an entity.
+         * @param entity : Entity uuid.
+         * @return Field reference, null when not found.
+         **/
+        auto Get( const AcheronUUID entity ) -> AcheronFieldReference<CompType> {
+            auto iterator = std::vector<AcheronUUID>::const_iterator( );
+            auto index    = size_t( 0 );
+
+            if ( !FindEntityIndex( entity, iterator, index ) )
+                return nullptr;
+
+            return GetReference( index );
+        };
+
+        /**
+         * Get const function
+         * @note : Get the component fields for an entity.
+         * @param entity : Entity uuid.
+         * @return Constant field reference, null when not found.
+         **/
+        auto Get( const AcheronUUID entity ) const -> AcheronFieldReference<const CompType> {
+            return const_cast<AcheronComponentStorage*>( this )->Get( entity );
+        };
+
+        /**
+         * Seek function
+         * @note : Get the component fields for an entity searching forward 
+         *         from a cursor, used for lock-step iteration over sorted 
+         *         entity lists.
+         * @param entity : Entity uuid, must not be lower than the entity 
+         *                 at cursor.
+         * @param cursor : Reference to the storage cursor, updated to the
+         *                 entity lower bound index.
+         * @return Field reference, null when not found.
+         **/
+        auto Seek( const AcheronUUID entity, uint32_t& cursor ) -> AcheronFieldReference<CompType> {
+            cursor = FindEntityIndexFrom( entity, cursor );
+
+            if ( cursor < m_entities.size( ) && m_entities[ cursor ] == entity )
+                return GetReference( cursor );
+
+            return nullptr;
+        };
+
+        /**
+         * Seek const function
+         * @note : Get the component fields for an entity searching forward 
+         *         from a cursor.
+         * @param entity : Entity uuid, must not be lower than the entity 
+         *                 at cursor.
+         * @param cursor : Reference to the storage cursor, updated to the
+         *                 entity lower bound index.
+         * @return Constant field reference, null when not found.
+         **/
+        auto Seek( const AcheronUUID entity, uint32_t& cursor ) const -> AcheronFieldReference<const CompType> {
+            return const_cast<AcheronComponentStorage*>( this )->Seek( entity, cursor );
+        };
+
+        /**
+         * GetAddress const function
+         * @note : Get the address of a component first field, used to align
+         *         parallel chunks on cache lines.
+         * @param index : Component index.
+         * @return Address of the component first field.
+         **/
+        const void* GetAddress( const size_t index ) const {
+            return std::get<0>( m_fields ).data( ) + index;
+        };
+
+    private:
+        /**
+         * GetReference function
+         * @note : Get the field reference of a component index.
+         * @param index : Component index.
+         * @return Field reference.
+         **/
+        auto GetReference( const size_t index ) -> AcheronFieldReference<CompType> {
+            return AcheronFieldReference<CompType>{ std::apply( [ index ]( auto&... fields ) {
+                return typename Fields::Pointers{ ( fields.data( ) + index )... };
+            }, m_fields ) };
+        };
+
+    };
+
+};
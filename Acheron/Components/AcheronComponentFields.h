@@ -0,0 +1,383 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once 
+
+#include "AcheronComponentTraits.h"
+
+namespace acs {
+
+    /**
+     * AcheronComponentFields template struct
+     * @note : Compile time description of a ACS_Storage_Fields component 
+     *         type fields, field types follow the component const qualifier.
+     * @template CompType : Component type, can be const qualified.
+     **/
+    template<typename CompType>
+    struct AcheronComponentFields {
+
+        using Type = std::remove_cv_t<CompType>;
+
+        static constexpr auto Members = AcheronComponentTraits<Type>::Fields;
+        static constexpr auto Count   = std::tuple_size_v<std::remove_cv_t<decltype( Members )>>;
+
+        template<size_t Index>
+        using RawField = std::remove_reference_t<decltype( std::declval<Type&>( ).*std::get<Index>( Members ) )>;
+
+        template<size_t Index>
+        using Field = std::conditional_t<std::is_const_v<CompType>, const RawField<Index>, RawField<Index>>;
+
+        /**
+         * IndexOf template static function
+         * @note : Get the index of a member in the field list.
+         * @template Member : Member pointer.
+         * @return Field index, Count when the member isn't a field.
+         **/
+        template<auto Member>
+        static constexpr size_t IndexOf( ) {
+            return [ ]<size_t... Indices>( std::index_sequence<Indices...> ) -> size_t {
+                auto index = Count;
+
+                ( [ & ]( ) -> void {
+                    if constexpr ( std::is_same_v<std::remove_cvref_t<decltype( std::get<Indices>( Members ) )>, decltype( Member )> ) {
+                        if ( index == Count && std::get<Indices>( Members ) == Member )
+                            index = Indices;
+                    }
+                }( ), ... );
+
+                return index;
+            }( std::make_index_sequence<Count>{ } );
+        };
+
+        /**
+         * Pointers alias
+         * @note : Tuple of one pointer per field.
+         **/
+        using Pointers = decltype( [ ]<size_t... Indices>( std::index_sequence<Indices...> ) {
+            return std::tuple<Field<Indices>*...>{ };
+        }( std::make_index_sequence<Count>{ } ) );
+
+    };
+
+    /**
+     * AcheronFieldReference template class
+     * @note : Proxy to a component stored field by field, used where the 
+     *         other layouts give a component pointer. The proxy is 
+     *         pointer-like : operator-> and + are supported, and it can be
+     *         tested like a pointer.
+     * @template CompType : Component type, can be const qualified.
+     **/
+    template<typename CompType>
+    class AcheronFieldReference final {
+
+        using Fields   = AcheronComponentFields<CompType>;
+        using Pointers = typename Fields::Pointers;
+
+        template<typename Other>
+        friend class AcheronFieldReference;
+
+    private:
+        Pointers m_fields;
+
+    public:
+        /**
+         * Constructor
+         * @note : Create a null reference.
+         **/
+        AcheronFieldReference( )
+            : AcheronFieldReference{ nullptr }
+        { };
+
+        /**
+         * Constructor
+         * @note : Create a null reference.
+         **/
+        AcheronFieldReference( std::nullptr_t )
+            : m_fields{ }
+        { };
+
+        /**
+         * Constructor
+         * @param fields : Pointers to the component fields.
+         **/
+        explicit AcheronFieldReference( const Pointers& fields )
+            : m_fields{ fields }
+        { };
+
+        /**
+         * Constructor
+         * @note : Convert a mutable reference to a constant one.
+         * @param other : Mutable reference.
+         **/
+        template<typename Other>
+            requires ( std::is_same_v<const Other, CompType> && !std::is_const_v<Other> )
+        AcheronFieldReference( const AcheronFieldReference<Other>& other )
+            : m_fields{ other.m_fields }
+        { };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronFieldReference( ) = default;
+
+        /**
+         * Store const method
+         * @note : Write every field of a component instance.
+         * @param component : Component instance to write.
+         **/
+        void Store( const typename Fields::Type& component ) const requires ( !std::is_const_v<CompType> ) {
+            [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                ( ( *std::get<Indices>( m_fields ) = component.*std::get<Indices>( Fields::Members ) ), ... );
+            }( std::make_index_sequence<Fields::Count>{ } );
+        };
+
+    public:
+        /**
+         * Get template const function
+         * @note : Get a field from its member pointer.
+         * @template Member : Member pointer declared in the component 
+         *                    traits Fields.
+         * @return Reference to the field.
+         **/
+        template<auto Member>
+        auto& Get( ) const {
+            constexpr auto index = Fields::template IndexOf<Member>( );
+
+            static_assert( index < Fields::Count, "Member isn't a field of the component traits." );
+
+            return *std::get<index>( m_fields );
+        };
+
+        /**
+         * GetField template const function
+         * @note : Get a field from its index in the component traits Fields.
+         * @template Index : Field index.
+         * @return Reference to the field.
+         **/
+        template<size_t Index>
+        auto& GetField( ) const {
+            return *std::get<Index>( m_fields );
+        };
+
+        /**
+         * Load const function
+         * @note : Read every field in a component instance.
+         * @return Component instance.
+         **/
+        auto Load( ) const -> typename Fields::Type {
+            auto component = typename Fields::Type{ };
+
+            [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                ( ( component.*std::get<Indices>( Fields::Members ) = *std::get<Indices>( m_fields ) ), ... );
+            }( std::make_index_sequence<Fields::Count>{ } );
+
+            return component;
+        };
+
+        /**
+         * Member access operator
+         * @note : Access the reference like a component pointer.
+         * @return Pointer to the reference.
+         **/
+        const AcheronFieldReference* operator->( ) const {
+            return this;
+        };
+
+        /**
+         * Addition operator
+         * @note : Get the reference of a following component.
+         * @param offset : Component offset.
+         * @return Field reference.
+         **/
+        AcheronFieldReference operator+( const size_t offset ) const {
+            return AcheronFieldReference{ std::apply( [ offset ]( auto*... fields ) -> Pointers {
+                return { ( fields + offset )... };
+            }, m_fields ) };
+        };
+
+        /**
+         * Bool operator
+         * @note : Check if the reference point to a component.
+         * @return True when the reference isn't null.
+         **/
+        explicit operator bool( ) const {
+            return std::get<0>( m_fields ) != nullptr;
+        };
+
+        /**
+         * Equality operator
+         * @note : Check if the reference is null.
+         * @return True when the reference is null.
+         **/
+        bool operator==( std::nullptr_t ) const {
+            return std::get<0>( m_fields ) == nullptr;
+        };
+
+    };
+
+    /**
+     * AcheronFieldSpan template class
+     * @note : Run of contiguous components stored field by field, used 
+     *         where the other layouts give a component span. Each field 
+     *         is a contiguous array that can be read with Get.
+     * @template CompType : Component type, can be const qualified.
+     **/
+    template<typename CompType>
+    class AcheronFieldSpan final {
+
+        using Fields = AcheronComponentFields<CompType>;
+
+        template<typename Other>
+        friend class AcheronFieldSpan;
+
+    private:
+        AcheronFieldReference<CompType> m_first;
+        size_t m_count;
+
+    public:
+        /**
+         * Constructor
+         * @note : Create an empty span.
+         **/
+        AcheronFieldSpan( )
+            : m_first{ },
+            m_count{ 0 }
+        { };
+
+        /**
+         * Constructor
+         * @param first : Reference to the first component.
+         * @param count : Component count.
+         **/
+        AcheronFieldSpan( const AcheronFieldReference<CompType>& first, const size_t count )
+            : m_first{ first },
+            m_count{ count }
+        { };
+
+        /**
+         * Constructor
+         * @note : Convert a mutable span to a constant one.
+         * @param other : Mutable span.
+         **/
+        template<typename Other>
+            requires ( std::is_same_v<const Other, CompType> && !std::is_const_v<Other> )
+        AcheronFieldSpan( const AcheronFieldSpan<Other>& other )
+            : m_first{ other.m_first },
+            m_count{ other.m_count }
+        { };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronFieldSpan( ) = default;
+
+        /**
+         * subspan const function
+         * @note : Get a part of the span.
+         * @param offset : First component index.
+         * @param count : Component count.
+         * @return Field span.
+         **/
+        AcheronFieldSpan subspan( const size_t offset, const size_t count ) const {
+            return { m_first + offset, count };
+        };
+
+        /**
+         * Index operator
+         * @note : Get a component reference.
+         * @param index : Component index.
+         * @return Field reference.
+         **/
+        AcheronFieldReference<CompType> operator[]( const size_t index ) const {
+            return m_first + index;
+        };
+
+    public:
+        /**
+         * Get template const function
+         * @note : Get a field array from its member pointer.
+         * @template Member : Member pointer declared in the component 
+         *                    traits Fields.
+         * @return Span of the field values.
+         **/
+        template<auto Member>
+        auto Get( ) const {
+            constexpr auto index = Fields::template IndexOf<Member>( );
+
+            static_assert( index < Fields::Count, "Member isn't a field of the component traits." );
+
+            return GetField<index>( );
+        };
+
+        /**
+         * GetField template const function
+         * @note : Get a field array from its index in the component traits
+         *         Fields.
+         * @template Index : Field index.
+         * @return Span of the field values.
+         **/
+        template<size_t Index>
+        auto GetField( ) const -> std::span<typename Fields::template Field<Index>> {
+            return { &m_first.template GetField<Index>( ), m_count };
+        };
+
+        /**
+         * data const function
+         * @note : Get the first component reference.
+         * @return Field reference.
+         **/
+        AcheronFieldReference<CompType> data( ) const {
+            return m_first;
+        };
+
+        /**
+         * size const function
+         * @note : Get component count.
+         * @return Component count as size_t.
+         **/
+        size_t size( ) const {
+            return m_count;
+        };
+
+        /**
+         * empty const function
+         * @note : Get if the span is empty.
+         * @return True when the span is empty.
+         **/
+        bool empty( ) const {
+            return m_count == 0;
+        };
+
+    };
+
+};
@@ -0,0 +1,240 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once 
+
+#include "AcheronComponentFields.h"
+
+namespace acs {
+
+    /**
+     * AcheronEmptyInstance template variable
+     * @note : Constant instance shared by every entity owning an 
+     *         ACS_Storage_Empty component, it can't be written so entities
+     *         never see each other changes.
+     * @template CompType : Empty component type.
+     **/
+    template<typename CompType>
+    inline const CompType AcheronEmptyInstance{ };
+
+    /**
+     * AcheronEmptySpan template class
+     * @note : Run of components of an empty type, every entry share the 
+     *         same constant instance since empty components hold no state.
+     * @template CompType : Empty component type, can be const qualified.
+     **/
+    template<typename CompType>
+    class AcheronEmptySpan final {
+
+        using ValueType = const std::remove_cv_t<CompType>;
+
+    private:
+        size_t m_count;
+
+    public:
+        /**
+         * Constructor
+         * @note : Create an empty span.
+         **/
+        AcheronEmptySpan( )
+            : m_count{ 0 }
+        { };
+
+        /**
+         * Constructor
+         * @param first : Unused component pointer, kept so the span is 
+         *                built like a std::span.
+         * @param count : Component count.
+         **/
+        AcheronEmptySpan( ValueType* first, const size_t count )
+            : m_count{ count }
+        { };
+
+        /**
+         * Constructor
+         * @note : Convert a mutable span to a constant one.
+         * @param other : Mutable span.
+         **/
+        template<typename Other>
+            requires ( std::is_same_v<const Other, CompType> && !std::is_const_v<Other> )
+        AcheronEmptySpan( const AcheronEmptySpan<Other>& other )
+            : m_count{ other.size( ) }
+        { };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronEmptySpan( ) = default;
+
+        /**
+         * subspan const function
+         * @note : Get a part of the span.
+         * @param offset : First component index.
+         * @param count : Component count.
+         * @return Empty span.
+         **/
+        AcheronEmptySpan subspan( const size_t offset, const size_t count ) const {
+            return { nullptr, count };
+        };
+
+        /**
+         * Index operator
+         * @note : Get a component.
+         * @param index : Component index.
+         * @return Constant reference to the shared instance.
+         **/
+        ValueType& operator[]( const size_t index ) const {
+            return *data( );
+        };
+
+    public:
+        /**
+         * data const function
+         * @note : Get the shared instance.
+         * @return Constant pointer to the shared instance.
+         **/
+        ValueType* data( ) const {
+            return &AcheronEmptyInstance<std::remove_cv_t<CompType>>;
+        };
+
+        /**
+         * size const function
+         * @note : Get component count.
+         * @return Component count as size_t.
+         **/
+        size_t size( ) const {
+            return m_count;
+        };
+
+        /**
+         * empty const function
+         * @note : Get if the span is empty.
+         * @return True when the span is empty.
+         **/
+        bool empty( ) const {
+            return m_count == 0;
+        };
+
+    };
+
+    /**
+     * AcheronComponentLayout template struct
+     * @note : Types given for a component by views and systems, a pointer
+     *         and a span, field proxies for ACS_Storage_Fields or a shared
+     *         instance span for ACS_Storage_Empty.
+     * @template CompType : Component type, can be const qualified.
+     * @template StorageType : Component storage layout type.
+     **/
+    template<typename CompType, AcheronStorageTypes StorageType = AcheronComponentTraits<std::remove_cv_t<CompType>>::Storage>
+    struct AcheronComponentLayout {
+
+        using Pointer = CompType*;
+        using Span    = std::span<CompType>;
+
+    };
+
+    template<typename CompType>
+    struct AcheronComponentLayout<CompType, ACS_Storage_Fields> {
+
+        using Pointer = AcheronFieldReference<CompType>;
+        using Span    = AcheronFieldSpan<CompType>;
+
+    };
+
+    template<typename CompType>
+    struct AcheronComponentLayout<CompType, ACS_Storage_Empty> {
+
+        using Pointer = const std::remove_cv_t<CompType>*;
+        using Span    = AcheronEmptySpan<CompType>;
+
+    };
+
+    /**
+     * AcheronComponentPointer alias
+     * @note : Component pointer given by views and systems, CompType* 
+     *         unless the component is stored by field.
+     * @template CompType : Component type.
+     **/
+    template<typename CompType>
+    using AcheronComponentPointer = typename AcheronComponentLayout<CompType>::Pointer;
+
+    /**
+     * AcheronComponentSpan alias
+     * @note : Component span given by batch views and systems, 
+     *         std::span<CompType> unless the component is stored by field
+     *         or empty.
+     * @template CompType : Component type.
+     **/
+    template<typename CompType>
+    using AcheronComponentSpan = typename AcheronComponentLayout<CompType>::Span;
+
+    /**
+     * GetComponentAt template function
+     * @note : Get the pointer of a span component.
+     * @template CompType : Component type.
+     * @param components : Component span.
+     * @param index : Component index.
+     * @return Component pointer.
+     **/
+    template<typename CompType>
+    CompType* GetComponentAt( std::span<CompType> components, const size_t index ) {
+        return components.data( ) + index;
+    };
+
+    /**
+     * GetComponentAt template function
+     * @note : Get the field reference of a span component.
+     * @template CompType : Component type.
+     * @param components : Field span.
+     * @param index : Component index.
+     * @return Field reference.
+     **/
+    template<typename CompType>
+    AcheronFieldReference<CompType> GetComponentAt( const AcheronFieldSpan<CompType>& components, const size_t index ) {
+        return components[ index ];
+    };
+
+    /**
+     * GetComponentAt template function
+     * @note : Get the shared instance of an empty component span.
+     * @template CompType : Component type.
+     * @param components : Empty span.
+     * @param index : Component index.
+     * @return Constant pointer to the shared instance.
+     **/
+    template<typename CompType>
+    const std::remove_cv_t<CompType>* GetComponentAt( const AcheronEmptySpan<CompType>& components, const size_t index ) {
+        return components.data( );
+    };
+
+};
@@ -38,26 +38,80 @@ namespace acs {
     //		===	PUBLIC ===
     ////////////////////////////////////////////////////////////////////////////////////////////
     AcheronComponentManager::AcheronComponentManager( )
-        : m_component_callbacks{ },
-        m_capacity{ StorageSize }
+        : m_capacity{ StorageSize },
+        m_storages{ },
+        m_job_system{ nullptr },
+        m_is_concurrent{ false }
     {
     }
 
     void AcheronComponentManager::Resize( const uint32_t capacity ) {
         m_capacity = capacity;
 
-        for ( auto pair : m_component_callbacks )
-            std::invoke( pair.second.Resize, capacity );
+        for ( auto& storage : m_storages ) {
+            if ( storage )
+                storage->Resize( capacity );
+        }
     }
 
     void AcheronComponentManager::Clear( const bool reset_capacity ) {
-        for ( auto pair : m_component_callbacks )
-            std::invoke( pair.second.Clear, reset_capacity );
+        for ( auto& storage : m_storages ) {
+            if ( storage )
+                storage->Clear( reset_capacity );
+        }
     }
 
     void AcheronComponentManager::Sweep( const std::vector<AcheronUUID>& entities ) {
-        for ( auto pair : m_component_callbacks )
-            std::invoke( pair.second.Sweep, entities );
+        ACS_PROFILE_SCOPE( "AcheronComponentManager::Sweep" );
+
+        if ( entities.empty( ) )
+            return;
+
+        auto sorted_entities = entities;
+
+        std::sort( sorted_entities.begin( ), sorted_entities.end( ) );
+        sorted_entities.erase( std::unique( sorted_entities.begin( ), sorted_entities.end( ) ), sorted_entities.end( ) );
+
+        if ( !m_job_system || m_job_system->GetWorkerCount( ) == 0 ) {
+            for ( auto& storage : m_storages ) {
+                if ( storage )
+                    storage->Sweep( sorted_entities );
+            }
+
+            return;
+        }
+
+        auto counter = AcheronJobCounter{ };
+
+        for ( auto& storage : m_storages ) {
+            if ( !storage )
+                continue;
+
+            m_job_system->Schedule( [ &storage, &sorted_entities ]( ) {
+                storage->Sweep( sorted_entities );
+            }, &counter );
+        }
+
+        m_job_system->WaitFor( counter );
+    }
+
+    void AcheronComponentManager::SetJobSystem( AcheronJobSystem* job_system ) {
+        m_job_system = job_system;
+    }
+
+    void AcheronComponentManager::SetIsConcurrent( const bool is_concurrent ) {
+        m_is_concurrent = is_concurrent;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC GET ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    AcheronJobSystem* AcheronComponentManager::GetJobSystem( ) const {
+        return m_job_system;
+    }
+
+    bool AcheronComponentManager::GetIsConcurrent( ) const {
+        return m_is_concurrent;
     }
 
 };
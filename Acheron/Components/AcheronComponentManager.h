@@ -32,7 +32,8 @@
 
 #pragma once 
 
-#include "AcheronComponentEntry.h"
+#include "AcheronComponentEmptyStorage.h"
+#include "../Jobs/AcheronJobSystem.h"
 
 namespace acs {
 
@@ -40,7 +41,9 @@ namespace acs {
 
     private:
         uint32_t m_capacity;
-        mutable std::unordered_map<AcheronUUID, AcheronComponentEntry> m_component_callbacks;
+        mutable std::vector<std::unique_ptr<IAcheronComponentStorage>> m_storages;
+        AcheronJobSystem* m_job_system;
+        bool m_is_concurrent;
 
     public:
         /**
@@ -72,11 +75,45 @@ namespace acs {
 
         /**
          * Sweep method
-         * @note : Perform actual component removing for dead entities.
+         * @note : Perform actual component removing for dead entities, the
+         *         entities are sorted once then each storage is compacted
+         *         in a single pass, storages are swept concurrently when a
+         *         job system is set.
          * @param entities : Reference to current entities to sweep.
          **/
         void Sweep( const std::vector<AcheronUUID>& entities );
 
+        /**
+         * SetJobSystem method
+         * @note : Set the job system used for sweep and parallel views.
+         * @param job_system : Pointer to the job system, can be nullptr to
+         *                     run everything on the calling thread.
+         **/
+        void SetJobSystem( AcheronJobSystem* job_system );
+
+        /**
+         * SetIsConcurrent method
+         * @note : Set if systems are running concurrently, storages can't
+         *         be created meanwhile as the storage list is shared.
+         * @param is_concurrent : True while concurrent systems run.
+         **/
+        void SetIsConcurrent( const bool is_concurrent );
+
+    public:
+        /**
+         * GetJobSystem const function
+         * @note : Get the job system used for sweep and parallel views.
+         * @return Pointer to the job system, can be nullptr.
+         **/
+        AcheronJobSystem* GetJobSystem( ) const;
+
+        /**
+         * GetIsConcurrent const function
+         * @note : Get if systems are running concurrently.
+         * @return True while concurrent systems run.
+         **/
+        bool GetIsConcurrent( ) const;
+
     public:
         /**
          * Clear template method
@@ -124,6 +161,35 @@ namespace acs {
             storage.Append( entity, std::move( component ) );
         };
 
+        /**
+         * AppendRange template method
+         * @note : Add a component to a range of entities with a single 
+         *         merge pass.
+         * @template CompType : Component type to append.
+         * @param entities : Entities uuids.
+         * @param components : Component instances to move, one per entity.
+         **/
+        template<typename CompType>
+        void AppendRange( std::span<const AcheronUUID> entities, std::span<CompType> components ) {
+            auto& storage = GetStorage<CompType>( );
+
+            storage.AppendRange( entities, components );
+        };
+
+        /**
+         * RemoveRange template method
+         * @note : Remove a component from a range of entities with a single
+         *         filter pass.
+         * @template CompType : Component type to remove.
+         * @param entities : Entities uuids.
+         **/
+        template<typename CompType>
+        void RemoveRange( std::span<const AcheronUUID> entities ) {
+            auto& storage = GetStorage<CompType>( );
+
+            storage.RemoveRange( entities );
+        };
+
         /**
          * Remove template method
          * @note : Remove a components from an entity.
@@ -139,44 +205,42 @@ namespace acs {
             }( ), ... );
         };
 
+    private:
         /**
-         * UnMarkDirty method
-         * @note : Unmark component collection dirty.
-         * @template CompType : Component type to unmark dirty.
+         * CreateStorage template method
+         * @note : Create the component storage for the registry slot.
+         * @template CompType : Storage component type.
+         * @param index : Component type registry index.
          **/
-        template<typename... CompTypes>
-        void UnMarkDirty( ) {
-            ( [ & ]( )-> void {
-                auto& storage = GetStorage<CompTypes>( );
+        template<typename CompType>
+        void CreateStorage( const size_t index ) const {
+            ACS_ASSERT( !m_is_concurrent, "Component storage created while systems run concurrently, declare the component in the system access." );
 
-                storage.UnMarkDirty( );
-            }( ), ... );
+            if ( index >= m_storages.size( ) )
+                m_storages.resize( index + 1 );
+
+            m_storages[ index ] = std::make_unique<AcheronComponentStorage<CompType>>( m_capacity );
         };
 
     public:
         /**
          * GetStorage template function
-         * @note : Get actual component storage instance.
-         * @template CompType : Storage component type.
+         * @note : Get actual component storage instance, the storage is 
+         *         created on first access.
+         * @template CompType : Storage component type, const qualifier is
+         *                      ignored.
          * @return Reference to component storage.
          **/
         template<typename CompType>
-        auto GetStorage( ) const -> AcheronComponentStorage<CompType>& {
-            static auto storage = AcheronComponentStorage<CompType>{
-                m_capacity,
-                [ this ]( const AcheronUUID component_uuid, AcheronComponentStorage<CompType>* storage ) {
-                    const auto component_entry = AcheronComponentEntry{
-                        [ storage ]( const uint32_t capacity ) { storage->Resize( capacity ); },
-                        [ storage ]( const bool reset_capacity ) { storage->Clear( reset_capacity ); },
-                        [ storage ]( const std::vector<AcheronUUID>& entities ) { storage->Sweep( entities ); }
-                    };
-                    const auto pair = std::make_pair( component_uuid, component_entry );
-
-                    m_component_callbacks.emplace( pair );
-                }
-            };
-
-            return storage;
+        auto GetStorage( ) const -> AcheronComponentStorageOf<CompType>& {
+            using StorageType = std::remove_cv_t<CompType>;
+
+            const auto index = size_t( GetComponentIndex<StorageType>( ) );
+
+            if ( index >= m_storages.size( ) || !m_storages[ index ] ) [[unlikely]]
+                CreateStorage<StorageType>( index );
+
+            return static_cast<AcheronComponentStorageOf<CompType>&>( *m_storages[ index ] );
         };
 
         /**
@@ -206,27 +270,29 @@ namespace acs {
         };
 
         /**
-         * GetComponentIsDirty const function
-         * @note : Get if a component is dirty.
+         * GetComponentVersion const function
+         * @note : Get component storage structural version.
          * @template CompType : Storage component type.
-         * @return True when the component is dirty.
+         * @return Component storage version as uint64_t.
          **/
         template<typename CompType>
-        bool GetComponentIsDirty( ) const {
+        uint64_t GetComponentVersion( ) const {
             auto& storage = GetStorage<CompType>( );
 
-            return storage.GetIsDirty( );
+            return storage.GetVersion( );
         };
 
         /**
-         * GetComponentAreDirty const function
-         * @note : Get if a collection of components are dirty.
-         * @template CompType : Storage component type.
-         * @return True when at least one component is dirty.
+         * GetStructureVersion const function
+         * @note : Get the sum of several component storage structural
+         *         versions, versions only grow so the sum change as soon
+         *         as one of the storages change.
+         * @template CompTypes : Storage component types.
+         * @return Summed component storage version as uint64_t.
          **/
         template<typename... CompTypes>
-        bool GetComponentAreDirty( ) const {
-            return ( GetComponentIsDirty<CompTypes>( ) || ... );
+        uint64_t GetStructureVersion( ) const {
+            return ( uint64_t( 0 ) + ... + GetStorage<CompTypes>( ).GetVersion( ) );
         };
 
         /**
@@ -244,12 +310,18 @@ namespace acs {
 
         /**
          * GetComponentVector template function
-         * @note : Get all component stored inside the storage.
+         * @note : Get all component stored inside the storage, only for 
+         *         layouts storing whole component instances.
          * @template CompType : Storage component type.
          * @return Constant reference to component vector.
          **/
         template<typename CompType>
         auto GetComponentVector( ) const -> const std::vector<CompType>& {
+            static_assert( 
+                AcheronComponentTraits<CompType>::Storage != ACS_Storage_Fields && AcheronComponentTraits<CompType>::Storage != ACS_Storage_Empty,
+                "GetComponentVector need a component vector, ACS_Storage_Fields components are read with GetStorage<CompType>( ).GetField<Member>( ) and ACS_Storage_Empty components store no instance."
+            );
+
             auto& storage = GetStorage<CompType>( );
 
             return storage.GetVector( );
@@ -260,10 +332,11 @@ namespace acs {
          * @note : Get component for a specific entity.
          * @template CompType : Storage component type.
          * @param entity : Target entity uuid.
-         * @return Pointer the component or nullptr if not found.
+         * @return Pointer the component or nullptr if not found, a field 
+         *         reference for ACS_Storage_Fields components.
          **/
         template<typename CompType>
-        auto GetComponent( const AcheronUUID entity ) -> CompType* {
+        auto GetComponent( const AcheronUUID entity ) -> AcheronComponentPointer<CompType> {
             auto& storage = GetStorage<CompType>( );
 
             return storage.Get( entity );
@@ -274,10 +347,11 @@ namespace acs {
          * @note : Get component for a specific entity.
          * @template CompType : Storage component type.
          * @param entity : Target entity uuid.
-         * @return Constant pointer the component or nullptr if not found.
+         * @return Constant pointer the component or nullptr if not found, a
+         *         field reference for ACS_Storage_Fields components.
          **/
         template<typename CompType>
-        auto GetComponent( const AcheronUUID entity ) const -> const CompType* {
+        auto GetComponent( const AcheronUUID entity ) const -> AcheronComponentPointer<const CompType> {
             auto& storage = GetStorage<CompType>( );
 
             return storage.Get( entity );
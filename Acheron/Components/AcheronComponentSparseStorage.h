@@ -0,0 +1,473 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once 
+
+#include "AcheronComponentStorage.h"
+
+namespace acs {
+
+    template<typename CompType>
+    class AcheronComponentStorage<CompType, ACS_Storage_Sparse> final
+        : public AcheronComponentStorageBase
+    {
+
+        // Sparse page entry count, sparse array is allocated per page.
+        static constexpr uint32_t PageSize = 4096;
+
+        // Sparse entry value for entity index without component.
+        static constexpr uint32_t Tombstone = UINT32_MAX;
+
+    public:
+        static constexpr bool IsSorted = false;
+
+    private:
+        std::vector<std::vector<uint32_t>> m_sparse;
+        std::vector<CompType> m_components;
+
+    public:
+        /**
+         * Constructor
+         * @param storage_capacity : Target default component capacity ( used 
+         *                           so if resize before the storage init, init
+         *                           with resize capacity ).
+         **/
+        AcheronComponentStorage( const uint32_t storage_capacity )
+            : AcheronComponentStorageBase{ },
+            m_sparse{ },
+            m_components{ }
+        {
+            const auto capacity = acs::GetStorageCapacity( storage_capacity );
+
+            m_entities.reserve( capacity );
+            m_components.reserve( capacity );
+        };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronComponentStorage( ) override = default;
+
+        /**
+         * Resize method
+         * @note : Resize the component storage to target capacity.
+         * @param capacity : Target new storage capacity.
+         **/
+        void Resize( const uint32_t capacity ) override {
+            const auto current_capacity = uint32_t( m_entities.capacity( ) );
+
+            m_sparse.clear( );
+            m_entities.clear( );
+            m_components.clear( );
+
+            if ( current_capacity < capacity )
+                Reallocate( capacity );
+            else {
+                const auto target_capacity = uint32_t( acs::GetStorageCapacity( capacity ) );
+
+                Reallocate( target_capacity );
+            }
+
+            IncrementVersion( );
+            DropChanges( );
+        };
+
+        /**
+         * Clear method
+         * @note : Clear all components and reset to defaut capacity if specified.
+         * @param reset_capacity : True to reset the capacity to default.
+         **/
+        void Clear( const bool reset_capacity ) override {
+            m_sparse.clear( );
+            m_entities.clear( );
+            m_components.clear( );
+
+            IncrementVersion( );
+            DropChanges( );
+
+            if ( !reset_capacity )
+                return;
+
+            Reallocate( acs::StorageSize );
+        };
+
+        /**
+         * Append method
+         * @note : Append a new component for the specified entity.
+         * @param entity : Component owning entity.
+         * @param component : New component instance to append.
+         **/
+        void Append( const AcheronUUID entity, CompType&& component ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sparse>::Append" );
+
+            if ( Contains( entity ) )
+                return;
+
+            IncrementVersion( );
+            Emplace( entity, std::move( component ) );
+            LogChange( entity );
+        };
+
+        /**
+         * AppendRange method
+         * @note : Append components for a range of entities with a single 
+         *         version increment, entities that already own a component
+         *         are skipped.
+         * @param entities : Entities uuids without duplicate.
+         * @param components : Component instances to move, one per entity.
+         **/
+        void AppendRange( std::span<const AcheronUUID> entities, std::span<CompType> components ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sparse>::AppendRange" );
+
+            ACS_ASSERT( entities.size( ) == components.size( ), "Component range size must match entity range size." );
+
+            if ( entities.empty( ) )
+                return;
+
+            const auto count = m_entities.size( ) + entities.size( );
+
+            if ( count > m_entities.capacity( ) )
+                Reserve( count );
+
+            const auto is_logged = BeginAppendRange( entities.size( ), count );
+            const auto version   = m_version + 1;
+            const auto old_count = m_entities.size( );
+
+            for ( auto index = size_t( 0 ); index < entities.size( ); index++ ) {
+                if ( Contains( entities[ index ] ) )
+                    continue;
+
+                Emplace( entities[ index ], std::move( components[ index ] ) );
+
+                if ( is_logged )
+                    m_changes.emplace_back( version, entities[ index ] );
+            }
+
+            if ( m_entities.size( ) > old_count )
+                EndAppendRange( is_logged );
+        };
+
+        /**
+         * Remove method
+         * @note : Remove a component for the specified entity, the last 
+         *         component is moved in the removed component place.
+         * @param entity : Component owning entity.
+         **/
+        void Remove( const AcheronUUID entity ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sparse>::Remove" );
+
+            const auto dense = FindDenseIndex( entity );
+
+            if ( dense == Tombstone )
+                return;
+
+            RemoveDense( dense );
+            IncrementVersion( );
+            LogChange( entity );
+        };
+
+        /**
+         * RemoveRange method
+         * @note : Remove components for a range of entities with a single
+         *         version increment.
+         * @param entities : Entities uuids.
+         **/
+        void RemoveRange( std::span<const AcheronUUID> entities ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sparse>::RemoveRange" );
+
+            auto is_changed = false;
+
+            for ( const auto entity : entities ) {
+                const auto dense = FindDenseIndex( entity );
+
+                if ( dense == Tombstone )
+                    continue;
+
+                if ( !is_changed ) {
+                    IncrementVersion( );
+
+                    is_changed = true;
+                }
+
+                RemoveDense( dense );
+                LogChange( entity );
+            }
+        };
+
+        /**
+         * Sweep method
+         * @note : Destroy component of the defered entity destruction vector.
+         * @param entities : Swept entities uuids sorted ascending without
+         *                   duplicate.
+         **/
+        void Sweep( std::span<const AcheronUUID> entities ) override {
+            RemoveRange( entities );
+        };
+
+    private:
+        /**
+         * Reallocate method
+         * @note : Reallocate interal vector using the following policy,
+         *		   capacity = acs::StorageSize < capacity ? capacity : StorageSize.
+         * @param capacity : New storage capacity.
+         **/
+        inline void Reallocate( const uint32_t capacity ) { 
+            auto temp_entities = std::vector<AcheronUUID>{ };
+            temp_entities.reserve( size_t( capacity ) );
+
+            m_entities.swap( temp_entities );
+
+            auto temp_components = std::vector<CompType>{ };
+            temp_components.reserve( size_t( capacity ) );
+
+            m_components.swap( temp_components );
+        };
+
+        /**
+         * Expand method
+         * @note : Expand dense vectors by at least acs::StorageOffset when
+         *		   the actual vectors can't hold more entities.
+         **/
+        void Expand( ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sparse>::Expand" );
+
+            Reserve( m_entities.capacity( ) + 1 );
+
+            ACS_PROFILE_COUNTER( "AcheronComponentStorage<Sparse>::Capacity", m_entities.capacity( ) );
+        };
+
+        /**
+         * Reserve method
+         * @note : Grow dense vectors to hold at least count components
+         *         following the Expand growth policy.
+         * @param count : Minimum component count to hold.
+         **/
+        void Reserve( const size_t count ) {
+            const auto capacity = GetGrowthCapacity( count );
+
+            m_entities.reserve( capacity );
+            m_components.reserve( capacity );
+        };
+
+        /**
+         * Emplace method
+         * @note : Emplace a component for an entity that don't own one yet,
+         *         the caller log the entity change.
+         * @param entity : Component owning entity.
+         * @param component : New component instance to append.
+         **/
+        void Emplace( const AcheronUUID entity, CompType&& component ) {
+            const auto dense = GetSlot( GetIndex( entity ) );
+
+            if ( dense != Tombstone ) {
+                // The slot is owned by a previous generation of the entity.
+                LogChange( m_entities[ dense ] );
+                RemoveDense( dense );
+            }
+
+            if ( m_components.size( ) == m_components.capacity( ) )
+                Expand( );
+
+            GetSlot( GetIndex( entity ) ) = uint32_t( m_entities.size( ) );
+
+            m_entities.emplace_back( entity );
+            m_components.emplace_back( std::move( component ) );
+        };
+
+        /**
+         * RemoveDense method
+         * @note : Swap and pop a dense entry.
+         * @param index : Dense index to remove.
+         **/
+        void RemoveDense( const uint32_t index ) {
+            const auto last = uint32_t( m_entities.size( ) - 1 );
+
+            GetSlot( GetIndex( m_entities[ index ] ) ) = Tombstone;
+
+            if ( index != last ) {
+                const auto last_entity = m_entities[ last ];
+
+                m_entities[ index ]   = last_entity;
+                m_components[ index ] = std::move( m_components[ last ] );
+
+                GetSlot( GetIndex( last_entity ) ) = index;
+            }
+
+            m_entities.pop_back( );
+            m_components.pop_back( );
+        };
+
+        /**
+         * GetSlot function
+         * @note : Get sparse slot for an entity index, allocate the page
+         *         when needed.
+         * @param index : Entity index.
+         * @return Reference to the sparse slot.
+         **/
+        uint32_t& GetSlot( const uint32_t index ) {
+            const auto page = size_t( index / PageSize );
+
+            if ( m_sparse.size( ) <= page )
+                m_sparse.resize( page + 1 );
+
+            if ( m_sparse[ page ].empty( ) )
+                m_sparse[ page ].resize( PageSize, Tombstone );
+
+            return m_sparse[ page ][ index % PageSize ];
+        };
+
+    public:
+        /**
+         * GetVector const function
+         * @note : Get current component vector.
+         * @return Constant reference to current component vector.
+         **/
+        auto GetVector( ) const -> const std::vector<CompType>& {
+            return m_components;
+        };
+
+        /**
+         * Contains const function
+         * @note : Get if an entity own a component instance.
+         * @param entity : Entity uuid.
+         * @return True when the entity own a component instance.
+         **/
+        bool Contains( const AcheronUUID entity ) const {
+            return FindDenseIndex( entity ) != Tombstone;
+        };
+
+        /**
+         * Get function
+         * @note : Get the component instance for an entity.
+         * @param entity : Entity uuid.
+         * @return Pointer to component instance or nullptr when not found.
+         **/
+        auto Get( const AcheronUUID entity ) -> CompType* {
+            auto* component  = (CompType*)nullptr;
+            const auto index = FindDenseIndex( entity );
+
+            if ( index != Tombstone )
+                component = &m_components[ index ];
+
+            return component;
+        };
+
+        /**
+         * Get const function
+         * @note : Get the component instance for an entity.
+         * @param entity : Entity uuid.
+         * @return Constant pointer to component instance or nullptr when not found.
+         **/
+        auto Get( const AcheronUUID entity ) const -> const CompType* {
+            auto* component  = (const CompType*)nullptr;
+            const auto index = FindDenseIndex( entity );
+
+            if ( index != Tombstone )
+                component = &m_components[ index ];
+
+            return component;
+        };
+
+        /**
+         * Seek function
+         * @note : Get the component instance for an entity, sparse lookup 
+         *         is already O(1) so the cursor is only updated to the 
+         *         dense index.
+         * @param entity : Entity uuid.
+         * @param cursor : Reference to the storage cursor.
+         * @return Pointer to component instance or nullptr when not found.
+         **/
+        auto Seek( const AcheronUUID entity, uint32_t& cursor ) -> CompType* {
+            auto* component = (CompType*)nullptr;
+
+            cursor = FindDenseIndex( entity );
+
+            if ( cursor != Tombstone )
+                component = &m_components[ cursor ];
+
+            return component;
+        };
+
+        /**
+         * Seek const function
+         * @note : Get the component instance for an entity.
+         * @param entity : Entity uuid.
+         * @param cursor : Reference to the storage cursor.
+         * @return Constant pointer to component instance or nullptr when not found.
+         **/
+        auto Seek( const AcheronUUID entity, uint32_t& cursor ) const -> const CompType* {
+            auto* component = (const CompType*)nullptr;
+
+            cursor = FindDenseIndex( entity );
+
+            if ( cursor != Tombstone )
+                component = &m_components[ cursor ];
+
+            return component;
+        };
+
+    private:
+        /**
+         * GetIndex const function
+         * @note : Get entity index from entity uuid.
+         * @param entity : Entity uuid.
+         * @return Index of the entity.
+         **/
+        uint32_t GetIndex( const AcheronUUID entity ) const {
+            return uint32_t( entity.Value & 0xFFFFFFFF );
+        };
+
+        /**
+         * FindDenseIndex const function
+         * @note : Find component dense index from entity uuid, generation
+         *         is checked against the dense entity uuid.
+         * @param entity : Entity uuid.
+         * @return Dense index or Tombstone when the entity has no component.
+         **/
+        uint32_t FindDenseIndex( const AcheronUUID entity ) const {
+            const auto index = GetIndex( entity );
+            const auto page  = size_t( index / PageSize );
+
+            if ( m_sparse.size( ) <= page || m_sparse[ page ].empty( ) )
+                return Tombstone;
+
+            const auto dense = m_sparse[ page ][ index % PageSize ];
+
+            if ( dense == Tombstone || m_entities[ dense ] != entity )
+                return Tombstone;
+
+            return dense;
+        };
+
+    };
+
+};
@@ -32,17 +32,20 @@
 
 #pragma once 
 
-#include "../Entities/AcheronEntityManager.h"
+#include "AcheronComponentStorageBase.h"
 
 namespace acs {
 
     template<typename CompType>
-    class AcheronComponentStorage final {
+    class AcheronComponentStorage<CompType, ACS_Storage_Sorted> final
+        : public AcheronComponentStorageBase
+    {
+
+    public:
+        static constexpr bool IsSorted = true;
 
     private:
-        std::vector<AcheronUUID> m_entities;
         std::vector<CompType> m_components;
-        bool m_is_dirty;
 
     public:
         /**
@@ -50,57 +53,28 @@ namespace acs {
          * @param storage_capacity : Target default component capacity ( used 
          *                           so if resize before the storage init, init
          *                           with resize capacity ).
-         * @param register_callback : Callback for storage registration.
          **/
-        AcheronComponentStorage(
-            const uint32_t storage_capacity,
-            std::function<void( const AcheronUUID, AcheronComponentStorage* )> register_callback
-        )
-            : m_entities{ },
-            m_components{ },
-            m_is_dirty{ false }
+        AcheronComponentStorage( const uint32_t storage_capacity )
+            : AcheronComponentStorageBase{ },
+            m_components{ }
         {
-            ACS_ASSERT( acs::StorageSize > 0, "Component storage size must always be non zero." );
-            ACS_ASSERT( acs::StorageOffset > 0, "Component storage offset must always be non zero." );
-            ACS_ASSERT( (bool)register_callback, "Component storage register callback must be populated." );
-
             const auto capacity = acs::GetStorageCapacity( storage_capacity );
 
             m_entities.reserve( capacity );
             m_components.reserve( capacity );
-
-            const auto component_uuid = AcheronUUID::Make<CompType>( );
-
-            std::invoke( register_callback, component_uuid, this );
         };
 
         /**
          * Destructor
          **/
-        ~AcheronComponentStorage( ) = default;
-
-        /**
-         * MarkDirty method
-         * @note : Mark the storage as dirty.
-         **/
-        inline void MarkDirty( ) {
-            m_is_dirty = true;
-        };
-
-        /**
-         * UnMarkDirty method
-         * @note : Un mark the storage as dirty.
-         **/
-        inline void UnMarkDirty( ) {
-            m_is_dirty = false;
-        };
+        ~AcheronComponentStorage( ) override = default;
 
         /**
          * Resize method
          * @note : Resize the component storage to target capacity.
          * @param capacity : Target new storage capacity.
          **/
-        void Resize( const uint32_t capacity ) {
+        void Resize( const uint32_t capacity ) override {
             const auto current_capacity = uint32_t( m_entities.capacity( ) );
 
             m_entities.clear( );
@@ -114,7 +88,8 @@ namespace acs {
                 Reallocate( target_capacity );
             }
 
-            UnMarkDirty( );
+            IncrementVersion( );
+            DropChanges( );
         };
 
         /**
@@ -122,15 +97,17 @@ namespace acs {
          * @note : Clear all components and reset to defaut capacity if specified.
          * @param reset_capacity : True to reset the capacity to default.
          **/
-        void Clear( const bool reset_capacity ) {
+        void Clear( const bool reset_capacity ) override {
             m_entities.clear( );
             m_components.clear( );
+
+            IncrementVersion( );
+            DropChanges( );
             
             if ( !reset_capacity )
                 return;
 
             Reallocate( acs::StorageSize );
-            UnMarkDirty( );
         };
 
         /**
@@ -140,6 +117,8 @@ namespace acs {
          * @param component : New component instance to append.
          **/
         void Append( const AcheronUUID entity, CompType&& component ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sorted>::Append" );
+
             if ( m_components.size( ) == m_components.capacity( ) )
                 Expand( );
 
@@ -154,7 +133,117 @@ namespace acs {
             m_entities.insert( iterator, entity );
             m_components.insert( component_start + index, std::move( component ) );
 
-            MarkDirty( );
+            IncrementVersion( );
+            LogChange( entity );
+        };
+
+        /**
+         * AppendRange method
+         * @note : Append components for a range of entities with a single 
+         *         sorted merge and a single version increment, entities 
+         *         that already own a component are skipped. Unsorted ranges
+         *         are sorted first, the first duplicate is kept.
+         * @param entities : Entities uuids.
+         * @param components : Component instances to move, one per entity.
+         **/
+        void AppendRange( std::span<const AcheronUUID> entities, std::span<CompType> components ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sorted>::AppendRange" );
+
+            ACS_ASSERT( entities.size( ) == components.size( ), "Component range size must match entity range size." );
+
+            if ( entities.empty( ) )
+                return;
+
+            if ( !GetIsSortedUnique( entities ) ) {
+                auto order = std::vector<uint32_t>( entities.size( ) );
+
+                std::iota( order.begin( ), order.end( ), 0 );
+                std::stable_sort( order.begin( ), order.end( ), [ & ]( const uint32_t a, const uint32_t b ) -> bool {
+                    return entities[ a ] < entities[ b ];
+                } );
+
+                auto sorted_entities   = std::vector<AcheronUUID>{ };
+                auto sorted_components = std::vector<CompType>{ };
+
+                sorted_entities.reserve( order.size( ) );
+                sorted_components.reserve( order.size( ) );
+
+                for ( const auto index : order ) {
+                    if ( !sorted_entities.empty( ) && sorted_entities.back( ) == entities[ index ] )
+                        continue;
+
+                    sorted_entities.emplace_back( entities[ index ] );
+                    sorted_components.emplace_back( std::move( components[ index ] ) );
+                }
+
+                AppendRange( sorted_entities, sorted_components );
+
+                return;
+            }
+
+            const auto count     = m_entities.size( ) + entities.size( );
+            const auto is_logged = BeginAppendRange( entities.size( ), count );
+            const auto version   = m_version + 1;
+
+            if ( m_entities.empty( ) || m_entities.back( ) < entities.front( ) ) {
+                if ( count > m_entities.capacity( ) )
+                    Reserve( count );
+
+                m_entities.insert( m_entities.end( ), entities.begin( ), entities.end( ) );
+                m_components.insert( 
+                    m_components.end( ), 
+                    std::make_move_iterator( components.begin( ) ), 
+                    std::make_move_iterator( components.end( ) ) 
+                );
+
+                if ( is_logged ) {
+                    for ( const auto entity : entities )
+                        m_changes.emplace_back( version, entity );
+                }
+
+                EndAppendRange( is_logged );
+
+                return;
+            }
+
+            auto temp_entities   = std::vector<AcheronUUID>{ };
+            auto temp_components = std::vector<CompType>{ };
+            auto capacity        = std::max( count, m_entities.capacity( ) );
+            auto old_index       = size_t( 0 );
+            auto new_index       = size_t( 0 );
+
+            temp_entities.reserve( capacity );
+            temp_components.reserve( capacity );
+
+            while ( old_index < m_entities.size( ) || new_index < entities.size( ) ) {
+                const auto is_old = new_index == entities.size( ) || ( old_index < m_entities.size( ) && m_entities[ old_index ] <= entities[ new_index ] );
+
+                if ( is_old ) {
+                    if ( new_index < entities.size( ) && m_entities[ old_index ] == entities[ new_index ] )
+                        new_index += 1;
+
+                    temp_entities.emplace_back( m_entities[ old_index ] );
+                    temp_components.emplace_back( std::move( m_components[ old_index ] ) );
+
+                    old_index += 1;
+                } else {
+                    temp_entities.emplace_back( entities[ new_index ] );
+                    temp_components.emplace_back( std::move( components[ new_index ] ) );
+
+                    if ( is_logged )
+                        m_changes.emplace_back( version, entities[ new_index ] );
+
+                    new_index += 1;
+                }
+            }
+
+            const auto is_appended = temp_entities.size( ) > m_entities.size( );
+
+            m_entities.swap( temp_entities );
+            m_components.swap( temp_components );
+
+            if ( is_appended )
+                EndAppendRange( is_logged );
         };
 
         /**
@@ -163,6 +252,8 @@ namespace acs {
          * @param entity : Component owning entity.
          **/
         void Remove( const AcheronUUID entity ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sorted>::Remove" );
+
             auto iterator = std::vector<AcheronUUID>::const_iterator( );
             auto index    = size_t( 0 );
 
@@ -174,17 +265,112 @@ namespace acs {
             m_entities.erase( iterator );
             m_components.erase( component_start + index );
 
-            MarkDirty( );
+            IncrementVersion( );
+            LogChange( entity );
+        };
+
+        /**
+         * RemoveRange method
+         * @note : Remove components for a range of entities filtering the 
+         *         storage in one pass from the first owned entity with a 
+         *         single version increment, unsorted ranges are sorted first.
+         * @param entities : Entities uuids.
+         **/
+        void RemoveRange( std::span<const AcheronUUID> entities ) {
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sorted>::RemoveRange" );
+
+            if ( entities.empty( ) || m_entities.empty( ) )
+                return;
+
+            if ( !GetIsSortedUnique( entities ) ) {
+                auto sorted_entities = std::vector<AcheronUUID>( entities.begin( ), entities.end( ) );
+
+                std::sort( sorted_entities.begin( ), sorted_entities.end( ) );
+                sorted_entities.erase( std::unique( sorted_entities.begin( ), sorted_entities.end( ) ), sorted_entities.end( ) );
+
+                RemoveRange( sorted_entities );
+
+                return;
+            }
+
+            if ( entities.back( ) < m_entities.front( ) || m_entities.back( ) < entities.front( ) )
+                return;
+
+            auto write_index  = size_t( 0 );
+            auto entity_index = size_t( 0 );
+
+            // Gallop to the first owned entity so storages holding none of
+            // the entities are left untouched.
+            for ( auto cursor = uint32_t( 0 ); entity_index < entities.size( ); entity_index++ ) {
+                cursor = FindEntityIndexFrom( entities[ entity_index ], cursor );
+
+                if ( cursor == m_entities.size( ) )
+                    return;
+
+                if ( m_entities[ cursor ] == entities[ entity_index ] ) {
+                    write_index = cursor;
+
+                    break;
+                }
+            }
+
+            if ( entity_index == entities.size( ) )
+                return;
+
+            const auto version = BeginRemoveRange( entities.size( ) - entity_index );
+            auto removed_count = size_t( 0 );
+
+            for ( auto read_index = write_index; read_index < m_entities.size( ); read_index++ ) {
+                const auto entity = m_entities[ read_index ];
+
+                if ( entity_index == entities.size( ) ) {
+                    const auto tail_count = m_entities.size( ) - read_index;
+
+                    std::move( m_entities.begin( ) + read_index, m_entities.end( ), m_entities.begin( ) + write_index );
+                    std::move( m_components.begin( ) + read_index, m_components.end( ), m_components.begin( ) + write_index );
+
+                    write_index += tail_count;
+
+                    break;
+                }
+
+                while ( entity_index < entities.size( ) && entities[ entity_index ] < entity )
+                    entity_index += 1;
+
+                if ( entity_index < entities.size( ) && entities[ entity_index ] == entity ) {
+                    m_changes.emplace_back( version, entity );
+
+                    removed_count += 1;
+                    entity_index  += 1;
+
+                    continue;
+                }
+
+                if ( write_index != read_index ) {
+                    m_entities[ write_index ]   = entity;
+                    m_components[ write_index ] = std::move( m_components[ read_index ] );
+                }
+
+                write_index += 1;
+            }
+
+            if ( removed_count == 0 )
+                return;
+
+            m_entities.resize( write_index );
+            m_components.erase( m_components.begin( ) + write_index, m_components.end( ) );
+
+            EndRemoveRange( );
         };
 
         /**
          * Sweep method
          * @note : Destroy component of the defered entity destruction vector.
-         * @param entities : Constant reference to current sweep vector.
+         * @param entities : Swept entities uuids sorted ascending without
+         *                   duplicate.
          **/
-        void Sweep( const std::vector<AcheronUUID>& entities ) {
-            for ( const auto entity : entities )
-                Remove( entity );
+        void Sweep( std::span<const AcheronUUID> entities ) override {
+            RemoveRange( entities );
         };
 
     private:
@@ -208,54 +394,32 @@ namespace acs {
 
         /**
          * Expand method
-         * @note : Expand internal vector by acs::StorageOffset when
-         *		   the actual vectors can't hold more entities.
+         * @note : Expand internal vector by at least acs::StorageOffset when
+         *		   the actual vectors can't hold more entities, growth follow
+         *		   half the current capacity to keep append amortized O(1).
          **/
         void Expand( ) {
-            const auto old_capacity = m_entities.capacity( );
-            const auto capacity = old_capacity + size_t( acs::StorageOffset );
-            
-            m_entities.reserve( capacity );
-            m_components.reserve( capacity );
-        };
+            ACS_PROFILE_SCOPE( "AcheronComponentStorage<Sorted>::Expand" );
 
-    public:
-        /**
-         * GetCount const function
-         * @note : Get valid component count.
-         * @return Valid component count as uint32_t.
-         **/
-        uint32_t GetCount( ) const { 
-            return uint32_t( m_components.size( ) );
-        };
+            Reserve( m_entities.capacity( ) + 1 );
 
-        /**
-         * GetCapacity const function
-         * @note : Get maximum allocated component count.
-         * @return Maximum allocated component count as uint32_t.
-         **/
-        uint32_t GetCapacity( ) const {
-            return uint32_t( m_components.capacity( ) );
+            ACS_PROFILE_COUNTER( "AcheronComponentStorage<Sorted>::Capacity", m_entities.capacity( ) );
         };
 
         /**
-         * GetIsDirty const function
-         * @note : Get if the storage is dirty.
-         * @return True when the storage is dirty.
+         * Reserve method
+         * @note : Grow internal vectors to hold at least count components
+         *         following the Expand growth policy.
+         * @param count : Minimum component count to hold.
          **/
-        bool GetIsDirty( ) const {
-            return m_is_dirty;
-        };
+        void Reserve( const size_t count ) {
+            const auto capacity = GetGrowthCapacity( count );
 
-        /**
-         * GetEntities const function
-         * @note : Get current component entities uuids vector.
-         * @return Constant reference to current component entities uuids vector.
-         **/
-        const std::vector<AcheronUUID>& GetEntities( ) const {
-            return m_entities;
+            m_entities.reserve( capacity );
+            m_components.reserve( capacity );
         };
 
+    public:
         /**
          * GetVector const function
          * @note : Get current component vector.
@@ -265,6 +429,19 @@ namespace acs {
             return m_components;
         };
 
+        /**
+         * Contains const function
+         * @note : Get if an entity own a component instance.
+         * @param entity : Entity uuid.
+         * @return True when the entity own a component instance.
+         **/
+        bool Contains( const AcheronUUID entity ) const {
+            auto iterator = std::vector<AcheronUUID>::const_iterator( );
+            auto index    = size_t( 0 );
+
+            return FindEntityIndex( entity, iterator, index );
+        };
+
         /**
          * Get function
          * @note : Get the component instance for an entity.
@@ -289,7 +466,7 @@ namespace acs {
          * @return Constant pointer to component instance or nullptr when not found.
          **/
         auto Get( const AcheronUUID entity ) const -> const CompType* {
-            auto* component = (CompType*)nullptr;
+            auto* component = (const CompType*)nullptr;
             auto iterator   = std::vector<AcheronUUID>::const_iterator( );
             auto index      = size_t( 0 );
 
@@ -299,49 +476,48 @@ namespace acs {
             return component;
         };
 
-    private:
         /**
-         * FindEntityIndex function
-         * @note : Find component index from entity uuid.
-         * @param entity : Entity uuid.
-         * @param iterator : Reference to entities uuids iterator.
-         * @param index : Reference to component index.
-         * @return True when the entity as a component instance, false otherwise.
+         * Seek function
+         * @note : Get the component instance for an entity searching 
+         *         forward from a cursor, used for lock-step iteration over
+         *         sorted entity lists. The search gallop from the cursor so
+         *         close entities cost O(1) and far ones O(log distance).
+         * @param entity : Entity uuid, must not be lower than the entity 
+         *                 at cursor.
+         * @param cursor : Reference to the storage cursor, updated to the
+         *                 entity lower bound index.
+         * @return Pointer to component instance or nullptr when not found.
          **/
-        bool FindEntityIndex(
-            const AcheronUUID entity,
-            std::vector<AcheronUUID>::iterator& iterator,
-            size_t& index
-        ) {
-            const auto iterator_start = m_entities.begin( );
-            const auto iterator_stop  = m_entities.end( );
-
-            iterator = std::lower_bound( iterator_start, iterator_stop, entity );
-            index    = std::distance( iterator_start, iterator );
-
-            return iterator != iterator_stop && *iterator != entity;
+        auto Seek( const AcheronUUID entity, uint32_t& cursor ) -> CompType* {
+            auto* component = (CompType*)nullptr;
+
+            cursor = FindEntityIndexFrom( entity, cursor );
+
+            if ( cursor < m_entities.size( ) && m_entities[ cursor ] == entity )
+                component = &m_components[ cursor ];
+
+            return component;
         };
-        
+
         /**
-         * FindEntityIndex const function
-         * @note : Find component index from entity uuid.
-         * @param entity : Entity uuid.
-         * @param iterator : Reference to entities uuids iterator.
-         * @param index : Reference to component index.
-         * @return True when the entity as a component instance, false otherwise.
+         * Seek const function
+         * @note : Get the component instance for an entity searching 
+         *         forward from a cursor.
+         * @param entity : Entity uuid, must not be lower than the entity 
+         *                 at cursor.
+         * @param cursor : Reference to the storage cursor, updated to the
+         *                 entity lower bound index.
+         * @return Constant pointer to component instance or nullptr when not found.
          **/
-        bool FindEntityIndex(
-            const AcheronUUID entity,
-            std::vector<AcheronUUID>::const_iterator& iterator,
-            size_t& index
-        ) const {
-            const auto iterator_start = m_entities.cbegin( );
-            const auto iterator_stop  = m_entities.cend( );
-
-            iterator = std::lower_bound( iterator_start, iterator_stop, entity );
-            index    = std::distance( iterator_start, iterator );
-
-            return iterator != iterator_stop && *iterator != entity;
+        auto Seek( const AcheronUUID entity, uint32_t& cursor ) const -> const CompType* {
+            auto* component = (const CompType*)nullptr;
+
+            cursor = FindEntityIndexFrom( entity, cursor );
+
+            if ( cursor < m_entities.size( ) && m_entities[ cursor ] == entity )
+                component = &m_components[ cursor ];
+
+            return component;
         };
 
     };
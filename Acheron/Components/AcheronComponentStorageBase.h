@@ -0,0 +1,352 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once 
+
+#include "AcheronComponentTraits.h"
+
+namespace acs {
+
+    /**
+     * AcheronComponentStorageBase class
+     * @note : State shared by every storage layout, entity list, 
+     *         structural version, change log and parallel iteration lock.
+     *         Layouts keep m_entities in the order of their components,
+     *         sorted layouts can use the sorted entity searches.
+     **/
+    class AcheronComponentStorageBase
+        : public IAcheronComponentStorage
+    {
+
+    protected:
+        std::vector<AcheronUUID> m_entities;
+        std::vector<AcheronComponentChange> m_changes;
+        uint64_t m_changes_version;
+        uint64_t m_version;
+        std::atomic<uint32_t> m_lock_count;
+
+    public:
+        /**
+         * Constructor
+         **/
+        AcheronComponentStorageBase( )
+            : m_entities{ },
+            m_changes{ },
+            m_changes_version{ 0 },
+            m_version{ 0 },
+            m_lock_count{ 0 }
+        {
+            ACS_ASSERT( acs::StorageSize > 0, "Component storage size must always be non zero." );
+            ACS_ASSERT( acs::StorageOffset > 0, "Component storage offset must always be non zero." );
+        };
+
+        /**
+         * Destructor
+         **/
+        virtual ~AcheronComponentStorageBase( ) = default;
+
+        /**
+         * Lock method
+         * @note : Forbid structural changes while components are accessed
+         *         from worker threads, locks can be nested.
+         **/
+        void Lock( ) {
+            m_lock_count.fetch_add( 1, std::memory_order_relaxed );
+        };
+
+        /**
+         * Unlock method
+         * @note : Release a lock taken with Lock.
+         **/
+        void Unlock( ) {
+            ACS_ASSERT( m_lock_count.load( std::memory_order_relaxed ) > 0, "Component storage unlocked more than locked." );
+
+            m_lock_count.fetch_sub( 1, std::memory_order_relaxed );
+        };
+
+    protected:
+        /**
+         * IncrementVersion method
+         * @note : Increment the storage structural version, called once 
+         *         per structural change.
+         **/
+        inline void IncrementVersion( ) {
+            ACS_ASSERT( m_lock_count.load( std::memory_order_relaxed ) == 0, "Component storage structural change while locked by a parallel iteration." );
+
+            m_version += 1;
+        };
+
+        /**
+         * LogChange method
+         * @note : Log an entity membership change at current version for 
+         *         incremental cache update, the log is dropped when it grows
+         *         over the change limit so big changes fallback to cache 
+         *         rebuild.
+         * @param entity : Changed entity uuid.
+         **/
+        inline void LogChange( const AcheronUUID entity ) {
+            if ( m_changes.size( ) < GetChangeLimit( m_entities.size( ) ) )
+                m_changes.emplace_back( m_version, entity );
+            else
+                DropChanges( );
+        };
+
+        /**
+         * BeginAppendRange function
+         * @note : Reserve the change log for a range append, appended 
+         *         entities are logged at version m_version + 1 while the
+         *         storage is merged, then EndAppendRange is called when at
+         *         least one entity was appended. The range isn't logged when
+         *         it would grow the log over the change limit or fill an 
+         *         empty storage, as caches are rebuilt from scratch anyway.
+         * @param count : Maximum appended entity count.
+         * @param storage_size : Maximum storage size once the range is applied.
+         * @return True when the range changes must be logged.
+         **/
+        bool BeginAppendRange( const size_t count, const size_t storage_size ) {
+            const auto is_logged = !m_entities.empty( ) && m_changes.size( ) + count <= GetChangeLimit( storage_size );
+
+            if ( is_logged )
+                m_changes.reserve( m_changes.size( ) + count );
+
+            return is_logged;
+        };
+
+        /**
+         * EndAppendRange method
+         * @note : Increment the version of a range append, the log is 
+         *         dropped when the range wasn't logged.
+         * @param is_logged : Value returned by BeginAppendRange.
+         **/
+        void EndAppendRange( const bool is_logged ) {
+            IncrementVersion( );
+
+            if ( !is_logged )
+                DropChanges( );
+        };
+
+        /**
+         * BeginRemoveRange function
+         * @note : Reserve the change log for a range removal, removed 
+         *         entities are logged at the returned version while the 
+         *         storage is compacted, then EndRemoveRange is called when
+         *         at least one entity was removed.
+         * @param count : Maximum removed entity count.
+         * @return Version of the removal.
+         **/
+        uint64_t BeginRemoveRange( const size_t count ) {
+            m_changes.reserve( m_changes.size( ) + std::min( { count, m_entities.size( ), GetChangeLimit( m_entities.size( ) ) } ) );
+
+            return m_version + 1;
+        };
+
+        /**
+         * EndRemoveRange method
+         * @note : Increment the version of a range removal, the log is 
+         *         dropped when it grew over the change limit.
+         **/
+        void EndRemoveRange( ) {
+            IncrementVersion( );
+
+            if ( m_changes.size( ) > GetChangeLimit( m_entities.size( ) ) )
+                DropChanges( );
+        };
+
+        /**
+         * DropChanges method
+         * @note : Drop the change log, caches older than current version 
+         *         will be rebuilt.
+         **/
+        inline void DropChanges( ) {
+            m_changes.clear( );
+
+            m_changes_version = m_version;
+        };
+
+        /**
+         * GetChangeLimit static function
+         * @note : Get the maximum change log size for a storage size, kept
+         *         well below the storage size as bigger change sets are 
+         *         applied faster with a cache rebuild.
+         * @param storage_size : Storage component count.
+         * @return Maximum change count.
+         **/
+        static size_t GetChangeLimit( const size_t storage_size ) {
+            return std::max( storage_size / 8, size_t( acs::StorageSize ) );
+        };
+
+        /**
+         * GetGrowthCapacity const function
+         * @note : Get the capacity to reserve for at least count components,
+         *         growth follow half the current capacity and at least 
+         *         acs::StorageOffset to keep append amortized O(1).
+         * @param count : Minimum component count to hold.
+         * @return New capacity.
+         **/
+        size_t GetGrowthCapacity( const size_t count ) const {
+            const auto old_capacity = m_entities.capacity( );
+
+            return std::max( count, old_capacity + std::max( size_t( acs::StorageOffset ), old_capacity / 2 ) );
+        };
+
+        /**
+         * FindEntityIndex const function
+         * @note : Find component index from entity uuid, for sorted layouts.
+         * @param entity : Entity uuid.
+         * @param iterator : Reference to entities uuids iterator.
+         * @param index : Reference to component index.
+         * @return True when the entity as a component instance, false otherwise.
+         **/
+        bool FindEntityIndex(
+            const AcheronUUID entity,
+            std::vector<AcheronUUID>::const_iterator& iterator,
+            size_t& index
+        ) const {
+            const auto iterator_start = m_entities.cbegin( );
+            const auto iterator_stop  = m_entities.cend( );
+
+            iterator = std::lower_bound( iterator_start, iterator_stop, entity );
+            index    = std::distance( iterator_start, iterator );
+
+            return iterator != iterator_stop && *iterator == entity;
+        };
+
+        /**
+         * FindEntityIndexFrom const function
+         * @note : Find entity lower bound index using a galloping search 
+         *         starting from cursor, for sorted layouts.
+         * @param entity : Entity uuid.
+         * @param cursor : Search start index.
+         * @return Index of the first entity not lower than entity.
+         **/
+        uint32_t FindEntityIndexFrom( const AcheronUUID entity, const uint32_t cursor ) const {
+            const auto count = uint32_t( m_entities.size( ) );
+            auto low  = cursor;
+            auto high = cursor;
+            auto step = uint32_t( 1 );
+
+            while ( high < count && m_entities[ high ] < entity ) {
+                low   = high + 1;
+                high += step;
+                step *= 2;
+            }
+
+            const auto iterator_start = m_entities.cbegin( );
+            const auto iterator_stop  = iterator_start + std::min( high, count );
+            const auto iterator       = std::lower_bound( iterator_start + low, iterator_stop, entity );
+
+            return uint32_t( std::distance( iterator_start, iterator ) );
+        };
+
+        /**
+         * GetIsSortedUnique static function
+         * @note : Get if an entity range is sorted ascending without duplicate.
+         * @param entities : Entities uuids.
+         * @return True when the range can be merged as is.
+         **/
+        static bool GetIsSortedUnique( std::span<const AcheronUUID> entities ) {
+            const auto iterator = std::adjacent_find( entities.begin( ), entities.end( ), std::greater_equal<AcheronUUID>{ } );
+
+            return iterator == entities.end( );
+        };
+
+    public:
+        /**
+         * GetCount const function
+         * @note : Get valid component count.
+         * @return Valid component count as uint32_t.
+         **/
+        uint32_t GetCount( ) const { 
+            return uint32_t( m_entities.size( ) );
+        };
+
+        /**
+         * GetCapacity const function
+         * @note : Get maximum allocated component count.
+         * @return Maximum allocated component count as uint32_t.
+         **/
+        uint32_t GetCapacity( ) const {
+            return uint32_t( m_entities.capacity( ) );
+        };
+
+        /**
+         * GetVersion const function
+         * @note : Get the storage structural version, incremented on each
+         *         structural change.
+         * @return Storage structural version.
+         **/
+        uint64_t GetVersion( ) const {
+            return m_version;
+        };
+
+        /**
+         * GetIsLocked const function
+         * @note : Get if the storage is locked against structural changes.
+         * @return True when at least one lock is held.
+         **/
+        bool GetIsLocked( ) const {
+            return m_lock_count.load( std::memory_order_relaxed ) > 0;
+        };
+
+        /**
+         * GetChangesVersion const function
+         * @note : Get the oldest version the change log can update from.
+         * @return Change log base version.
+         **/
+        uint64_t GetChangesVersion( ) const {
+            return m_changes_version;
+        };
+
+        /**
+         * GetChanges const function
+         * @note : Get entities membership changes since the change log 
+         *         version sorted by version, entities can be duplicated.
+         * @return Constant reference to changes vector.
+         **/
+        auto GetChanges( ) const -> const std::vector<AcheronComponentChange>& {
+            return m_changes;
+        };
+
+        /**
+         * GetEntities const function
+         * @note : Get current component entities uuids vector, in component
+         *         order.
+         * @return Constant reference to current component entities uuids vector.
+         **/
+        const std::vector<AcheronUUID>& GetEntities( ) const {
+            return m_entities;
+        };
+
+    };
+
+};
@@ -37,20 +37,10 @@ namespace acs {
     ////////////////////////////////////////////////////////////////////////////////////////////
     //		===	PUBLIC ===
     ////////////////////////////////////////////////////////////////////////////////////////////
-    AcheronComponentEntry::AcheronComponentEntry( )
-        : AcheronComponentEntry{ { }, { }, { } }
-    {
-    }
+    uint32_t GetNextComponentIndex( ) {
+        static auto next_index = std::atomic<uint32_t>{ 0 };
 
-    AcheronComponentEntry::AcheronComponentEntry(
-        std::function<void( const uint32_t )> resize,
-        std::function<void( const bool )> clear,
-        std::function<void( const std::vector<AcheronUUID>& )> sweep
-    )
-        : Resize{ resize },
-        Clear{ clear },
-        Sweep{ sweep } 
-    { 
+        return next_index.fetch_add( 1, std::memory_order_relaxed );
     }
 
 };
@@ -0,0 +1,151 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once 
+
+#include "../Entities/AcheronEntityManager.h"
+#include "../Utils/AcheronProfiler.h"
+
+namespace acs {
+
+    enum AcheronStorageTypes : uint32_t { 
+
+        ACS_Storage_Sorted = 0,
+        ACS_Storage_Sparse,
+        ACS_Storage_Fields,
+        ACS_Storage_Empty
+
+    };
+
+    /**
+     * AcheronComponentTraits template struct
+     * @note : Per component type configuration, specialize it to change
+     *         the storage layout used for a component type. The 
+     *         ACS_Storage_Fields layout also need a static constexpr 
+     *         Fields tuple of member pointers, each member is stored in 
+     *         its own array, members left out aren't stored :
+     *         static constexpr auto Fields = std::make_tuple( &Type::X, &Type::Y );
+     *         Empty types can use ACS_Storage_Empty, only the owning 
+     *         entities are stored and every entity share one constant
+     *         instance.
+     * @template CompType : Component type.
+     **/
+    template<typename CompType>
+    struct AcheronComponentTraits {
+
+        static constexpr AcheronStorageTypes Storage = ACS_Storage_Sorted;
+
+    };
+
+    struct AcheronComponentChange {
+
+        uint64_t Version;
+        AcheronUUID Entity;
+
+    };
+
+    struct IAcheronComponentStorage {
+
+        /**
+         * Destructor
+         **/
+        virtual ~IAcheronComponentStorage( ) = default;
+
+        /**
+         * Resize pure-virtual method
+         * @note : Resize the component storage to target capacity.
+         * @param capacity : Target new storage capacity.
+         **/
+        virtual void Resize( const uint32_t capacity ) = 0;
+
+        /**
+         * Clear pure-virtual method
+         * @note : Clear all components and reset to defaut capacity if specified.
+         * @param reset_capacity : True to reset the capacity to default.
+         **/
+        virtual void Clear( const bool reset_capacity ) = 0;
+
+        /**
+         * Sweep pure-virtual method
+         * @note : Destroy component of the defered entity destruction vector.
+         * @param entities : Swept entities uuids sorted ascending without
+         *                   duplicate.
+         **/
+        virtual void Sweep( std::span<const AcheronUUID> entities ) = 0;
+
+    };
+
+    /**
+     * GetNextComponentIndex function
+     * @note : Allocate a new dense component type index.
+     * @return New component type index.
+     **/
+    ACS_API uint32_t GetNextComponentIndex( );
+
+    /**
+     * GetComponentIndex template function
+     * @note : Get the dense runtime index of a component type, used to 
+     *         index the component manager storage registry. The index is
+     *         given on first use.
+     * @template CompType : Component type.
+     * @return Component type index.
+     **/
+    template<typename CompType>
+    uint32_t GetComponentIndex( ) {
+        static const auto index = GetNextComponentIndex( );
+
+        return index;
+    };
+
+    /**
+     * AcheronComponentStorage template class
+     * @note : Component storage, the layout is selected by the component
+     *         traits Storage value.
+     * @template CompType : Component type.
+     * @template StorageType : Storage layout type.
+     **/
+    template<
+        typename CompType,
+        AcheronStorageTypes StorageType = AcheronComponentTraits<CompType>::Storage
+    >
+    class AcheronComponentStorage;
+
+    /**
+     * AcheronComponentStorageOf alias
+     * @note : Storage of a component type, const qualified component types
+     *         used for read access share the storage of the mutable type.
+     * @template CompType : Component type.
+     **/
+    template<typename CompType>
+    using AcheronComponentStorageOf = AcheronComponentStorage<std::remove_cv_t<CompType>>;
+
+};
@@ -32,7 +32,7 @@
 
 #pragma once
 
-#include "AcheronComponentViewIterator.h"
+#include "Standard/ArcheronTag.h"
 
 namespace acs {
 
@@ -41,7 +41,9 @@ namespace acs {
 
     private:
         AcheronComponentManager& m_component_manager;
-        const std::vector<AcheronUUID>& m_entities;
+        const std::vector<AcheronUUID>* m_entities;
+        std::vector<AcheronUUID> m_filtered;
+        bool m_is_filtered;
 
     public:
         /**
@@ -54,7 +56,9 @@ namespace acs {
             AcheronComponentCache& component_cache
         )
             : m_component_manager{ component_manager },
-            m_entities{ component_cache.Get<CompTypes...>( component_manager ) }
+            m_entities{ &component_cache.Get<CompTypes...>( component_manager ) },
+            m_filtered{ },
+            m_is_filtered{ false }
         { };
 
         /**
@@ -68,7 +72,7 @@ namespace acs {
          * @return Return view iterator for the first entitiy uuid. 
          **/
         auto begin( ) -> AcheronComponentViewIterator<CompTypes...> {
-            return { m_component_manager, m_entities, 0 };
+            return { m_component_manager, GetEntities( ), 0 };
         };
 
         /**
@@ -77,9 +81,405 @@ namespace acs {
          * @return Return view iterator for the last entitiy uuid.
          **/
         auto end( )  -> AcheronComponentViewIterator<CompTypes...> {
-            const auto count = uint32_t( m_entities.size( ) );
+            const auto count = uint32_t( GetEntities( ).size( ) );
 
-            return { m_component_manager, m_entities, count };
+            return { m_component_manager, GetEntities( ), count };
+        };
+
+        /**
+         * ParallelEach template method
+         * @note : Call a function for each view entry, entries are split in
+         *         contiguous chunks processed by the component manager job
+         *         system and run on the calling thread when no worker is 
+         *         available. View storages are locked during the call so 
+         *         the function must not add or remove components, and must
+         *         only write to the components of its own entry.
+         * @template Function : Function type, called with a reference to 
+         *                      the view iterator tuple.
+         * @param function : Function to call for each entry.
+         * @param grain : Minimum entry count per chunk.
+         **/
+        template<typename Function>
+        void ParallelEach( Function&& function, const uint32_t grain ) {
+            Dispatch( grain, [ this, &function ]( const uint32_t start, const uint32_t stop ) -> void {
+                Each( function, start, stop );
+            } );
+        };
+
+        /**
+         * EachBatch template method
+         * @note : Call a function for each run of view entries whose 
+         *         components are contiguous in every view storage.
+         * @template Function : Function type, called with the run entity
+         *                      span followed by one AcheronComponentSpan
+         *                      per view component type.
+         * @param function : Function to call for each run.
+         **/
+        template<typename Function>
+        void EachBatch( Function&& function ) {
+            EachBatch( function, 0, uint32_t( GetEntities( ).size( ) ) );
+        };
+
+        /**
+         * ParallelEachBatch template method
+         * @note : Call a function for each run of contiguous view entries,
+         *         runs are computed inside the chunks of ParallelEach and 
+         *         follow the same rules.
+         * @template Function : Function type, called with the run entity
+         *                      span followed by one component span per 
+         *                      view component type.
+         * @param function : Function to call for each run.
+         * @param grain : Minimum entry count per chunk.
+         **/
+        template<typename Function>
+        void ParallelEachBatch( Function&& function, const uint32_t grain ) {
+            Dispatch( grain, [ this, &function ]( const uint32_t start, const uint32_t stop ) -> void {
+                EachBatch( function, start, stop );
+            } );
+        };
+
+        /**
+         * WithTags const function
+         * @note : Get a copy of the view keeping only entries whose tag
+         *         flags are all set or all cleared, like 
+         *         WithTags( ACS_Ignore, false ) to skip ignored entities.
+         * @param tags : Tag flags to test.
+         * @param is_set : True when flags must be set, false when they 
+         *                 must be cleared.
+         * @return Filtered view.
+         **/
+        AcheronComponentView WithTags( const uint64_t tags, const bool is_set ) const {
+            if ( is_set )
+                return WithTags( AcheronTagFilter{ tags, Tags::ACS_None, Tags::ACS_None } );
+
+            return WithTags( AcheronTagFilter{ Tags::ACS_None, Tags::ACS_None, tags } );
+        };
+
+        /**
+         * WithAnyTags const function
+         * @note : Get a copy of the view keeping only entries with at least
+         *         one of the tag flags set.
+         * @param tags : Tag flags to test.
+         * @return Filtered view.
+         **/
+        AcheronComponentView WithAnyTags( const uint64_t tags ) const {
+            return WithTags( AcheronTagFilter{ Tags::ACS_None, tags, Tags::ACS_None } );
+        };
+
+        /**
+         * WithTags const function
+         * @note : Get a copy of the view keeping only entries whose tag 
+         *         match a filter. The AcheronTag storage is scanned once 
+         *         into a bitmask that is then intersected with the view 
+         *         entries, so skipping entries cost no branch in the 
+         *         processing loop. Entities without AcheronTag are tested
+         *         as ACS_None. Filters can be chained.
+         * @param filter : Tag filter to apply.
+         * @return Filtered view.
+         **/
+        AcheronComponentView WithTags( const AcheronTagFilter& filter ) const {
+            auto view = *this;
+
+            if ( !filter.GetIsEmpty( ) )
+                view.Filter( filter );
+
+            return view;
+        };
+
+    private:
+        /**
+         * Filter method
+         * @note : Replace view entries with the ones matching a tag filter,
+         *         the tag storage is walked in lock-step with the entries 
+         *         as both are sorted and the whole storage is scanned 
+         *         anyway. When the view hold every tagged entity the mask
+         *         set bits are the kept entries.
+         * @param filter : Tag filter to apply.
+         **/
+        void Filter( const AcheronTagFilter& filter ) {
+            const auto& storage  = m_component_manager.GetStorage<AcheronTag>( );
+            const auto& tagged   = storage.GetEntities( );
+            const auto& entities = GetEntities( );
+            const auto is_none   = filter.GetMatch( Tags::ACS_None );
+            auto mask            = std::vector<uint64_t>{ };
+            const auto matches   = filter.Scan( storage.GetVector( ), mask );
+
+            if ( is_none && matches == tagged.size( ) )
+                return;
+
+            auto filtered = std::vector<AcheronUUID>( entities.size( ) );
+            auto cursor   = size_t( 0 );
+            auto count    = size_t( 0 );
+
+            if ( entities.size( ) == tagged.size( ) && std::equal( entities.begin( ), entities.end( ), tagged.begin( ) ) ) {
+                for ( auto block = size_t( 0 ); block < mask.size( ); block++ ) {
+                    for ( auto bits = mask[ block ]; bits != 0; bits &= bits - 1 )
+                        filtered[ count++ ] = entities[ block * 64 + size_t( std::countr_zero( bits ) ) ];
+                }
+            } else {
+                for ( const auto entity : entities ) {
+                    while ( cursor < tagged.size( ) && tagged[ cursor ] < entity )
+                        cursor += 1;
+
+                    const auto is_tagged = cursor < tagged.size( ) && tagged[ cursor ] == entity;
+                    const auto is_match  = is_tagged ? ( ( mask[ cursor / 64 ] >> ( cursor % 64 ) ) & 1 ) != 0 : is_none;
+
+                    filtered[ count ] = entity;
+                    count            += size_t( is_match );
+                }
+            }
+
+            filtered.resize( count );
+
+            m_filtered    = std::move( filtered );
+            m_is_filtered = true;
+        };
+
+        /**
+         * Dispatch template method
+         * @note : Split view entries in chunks processed by the component 
+         *         manager job system, or on the calling thread when no 
+         *         worker is available. View storages are locked during the 
+         *         call.
+         * @template Function : Chunk function type.
+         * @param grain : Minimum entry count per chunk.
+         * @param function : Chunk function taking [ start, stop [.
+         **/
+        template<typename Function>
+        void Dispatch( const uint32_t grain, Function&& function ) {
+            ACS_ASSERT( grain > 0, "Parallel each grain must be non zero." );
+
+            const auto count = uint32_t( GetEntities( ).size( ) );
+            auto* job_system = m_component_manager.GetJobSystem( );
+
+            if ( count == 0 )
+                return;
+
+            ( m_component_manager.GetStorage<CompTypes>( ).Lock( ), ... );
+
+            if ( !job_system || job_system->GetWorkerCount( ) == 0 || count <= grain )
+                function( 0, count );
+            else {
+                auto counter = AcheronJobCounter{ };
+                auto start   = uint32_t( 0 );
+
+                while ( start < count ) {
+                    const auto stop = AlignChunk( start + grain );
+
+                    job_system->Schedule( [ &function, start, stop ]( ) {
+                        function( start, stop );
+                    }, &counter );
+
+                    start = stop;
+                }
+
+                job_system->WaitFor( counter );
+            }
+
+            ( m_component_manager.GetStorage<CompTypes>( ).Unlock( ), ... );
+        };
+
+        /**
+         * Each template method
+         * @note : Call a function for each view entry in a range.
+         * @template Function : Function type.
+         * @param function : Reference to the function to call.
+         * @param start : First entry index.
+         * @param stop : Entry index after the last entry.
+         **/
+        template<typename Function>
+        void Each( Function& function, const uint32_t start, const uint32_t stop ) {
+            auto iterator = AcheronComponentViewIterator<CompTypes...>{ m_component_manager, GetEntities( ), start };
+            auto last     = AcheronComponentViewIterator<CompTypes...>{ m_component_manager, GetEntities( ), stop };
+
+            for ( ; iterator != last; ++iterator ) {
+                auto components = *iterator;
+
+                function( components );
+            }
+        };
+
+        /**
+         * EachBatch template method
+         * @note : Call a function for each run of contiguous view entries
+         *         in a range, a run ends when any storage entity list stop
+         *         matching the view entity list. Cursors are reset when
+         *         the function made a structural change to a viewed storage,
+         *         an entry that lost a component is then given alone with a
+         *         null span.
+         * @template Function : Function type.
+         * @param function : Reference to the function to call.
+         * @param start : First entry index.
+         * @param stop : Entry index after the last entry.
+         **/
+        template<typename Function>
+        void EachBatch( Function& function, const uint32_t start, const uint32_t stop ) {
+            auto storages = std::tuple<AcheronComponentStorageOf<CompTypes>*...>{ &m_component_manager.GetStorage<CompTypes>( )... };
+            auto cursors  = std::array<uint32_t, sizeof...( CompTypes )>{ };
+            auto version  = m_component_manager.GetStructureVersion<CompTypes...>( );
+            auto index    = start;
+
+            while ( index < stop ) {
+                auto length = size_t( stop - index );
+
+                if ( const auto current = m_component_manager.GetStructureVersion<CompTypes...>( ); current != version ) [[unlikely]] {
+                    cursors.fill( 0 );
+
+                    version = current;
+                }
+
+                [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                    const auto entity     = GetEntities( )[ index ];
+                    const auto components = std::tuple<AcheronComponentPointer<CompTypes>...>{ std::get<Indices>( storages )->Seek( entity, cursors[ Indices ] )... };
+
+                    if ( ( static_cast<bool>( std::get<Indices>( components ) ) && ... ) ) [[likely]]
+                        ( ( length = GetRunLength( *std::get<Indices>( storages ), cursors[ Indices ], index, length ) ), ... );
+                    else
+                        length = 1;
+
+                    function( 
+                        std::span<const AcheronUUID>{ GetEntities( ).data( ) + index, length },
+                        AcheronComponentSpan<CompTypes>{ std::get<Indices>( components ), length }... 
+                    );
+                }( std::index_sequence_for<CompTypes...>{ } );
+
+                index += uint32_t( length );
+            }
+        };
+
+        /**
+         * GetRunLength template const function
+         * @note : Get how many view entries from an index are stored next to
+         *         each other in a storage. View entries are a sorted subset 
+         *         of sorted storages entities, once an entry is stored after
+         *         its run slot every following entry is too, so the run end
+         *         is galloped then binary searched, short runs cost a few 
+         *         probes. Sparse storages are compared linearly.
+         * @template StorageType : Component storage type.
+         * @param storage : Reference to the component storage.
+         * @param cursor : Storage index of the entry at index.
+         * @param index : First entry index.
+         * @param length : Maximum run length.
+         * @return Run length, at least 1.
+         **/
+        template<typename StorageType>
+        size_t GetRunLength(
+            const StorageType& storage,
+            const uint32_t cursor,
+            const uint32_t index,
+            const size_t length
+        ) const {
+            const auto& entities = storage.GetEntities( );
+            const auto count     = std::min( length, entities.size( ) - cursor );
+            const auto first     = GetEntities( ).begin( ) + index;
+
+            if constexpr ( StorageType::IsSorted ) {
+                auto low  = size_t( 1 );
+                auto high = size_t( 1 );
+
+                while ( high < count && first[ high ] == entities[ cursor + high ] ) {
+                    low  = high + 1;
+                    high = high * 2;
+                }
+
+                high = std::min( high, count );
+
+                while ( low < high ) {
+                    const auto middle = low + ( high - low ) / 2;
+
+                    if ( first[ middle ] == entities[ cursor + middle ] )
+                        low = middle + 1;
+                    else
+                        high = middle;
+                }
+
+                return low;
+            } else
+                return size_t( std::mismatch( first, first + count, entities.begin( ) + cursor ).first - first );
+        };
+
+        /**
+         * AlignChunk const function
+         * @note : Move a chunk boundary forward so it starts a cache line 
+         *         in the first written sorted storage of the view, chunks 
+         *         then never write to the same cache line. Empty 
+         *         components are never written and are skipped.
+         * @param index : Chunk boundary entry index.
+         * @return Aligned chunk boundary entry index.
+         **/
+        uint32_t AlignChunk( const uint32_t index ) const {
+            const auto count = uint32_t( GetEntities( ).size( ) );
+            auto boundary    = std::min( index, count );
+            auto is_aligned  = false;
+
+            ( [ & ]( ) -> void {
+                if constexpr ( !std::is_const_v<CompTypes> && AcheronComponentStorageOf<CompTypes>::IsSorted && AcheronComponentTraits<CompTypes>::Storage != ACS_Storage_Empty ) {
+                    if ( !is_aligned && boundary < count )
+                        boundary = AlignChunkTo<CompTypes>( boundary );
+
+                    is_aligned = true;
+                }
+            }( ), ... );
+
+            return boundary;
+        };
+
+        /**
+         * AlignChunkTo template const function
+         * @note : Move a chunk boundary forward to the first view entry 
+         *         whose component start a cache line, the first field 
+         *         array is used for ACS_Storage_Fields components.
+         * @template CompType : Written sorted component type.
+         * @param boundary : Chunk boundary entry index.
+         * @return Aligned chunk boundary entry index, or unchanged when no 
+         *         component start a cache line nearby.
+         **/
+        template<typename CompType>
+        uint32_t AlignChunkTo( const uint32_t boundary ) const {
+            const auto& view_entities = GetEntities( );
+            const auto& storage       = m_component_manager.GetStorage<CompType>( );
+            const auto& entities      = storage.GetEntities( );
+            auto storage_index        = size_t( std::lower_bound( entities.begin( ), entities.end( ), view_entities[ boundary ] ) - entities.begin( ) );
+            const auto limit          = std::min( storage_index + CacheLineSize, entities.size( ) );
+            const auto address        = [ & ]( const size_t index ) -> uintptr_t {
+                if constexpr ( AcheronComponentTraits<CompType>::Storage == ACS_Storage_Fields )
+                    return uintptr_t( storage.GetAddress( index ) );
+                else
+                    return uintptr_t( &storage.GetVector( )[ index ] );
+            };
+
+            while ( storage_index < limit && address( storage_index ) % CacheLineSize != 0 )
+                storage_index += 1;
+
+            if ( storage_index == entities.size( ) )
+                return uint32_t( view_entities.size( ) );
+
+            if ( storage_index == limit )
+                return boundary;
+
+            const auto iterator = std::lower_bound( view_entities.begin( ) + boundary, view_entities.end( ), entities[ storage_index ] );
+
+            return uint32_t( iterator - view_entities.begin( ) );
+        };
+
+    public:
+        /**
+         * GetCount const function
+         * @note : Get view entry count.
+         * @return View entry count as uint32_t.
+         **/
+        uint32_t GetCount( ) const {
+            return uint32_t( GetEntities( ).size( ) );
+        };
+
+        /**
+         * GetEntities const function
+         * @note : Get view entity list, the tag filtered list when the 
+         *         view was filtered.
+         * @return Constant reference to view entity list.
+         **/
+        const std::vector<AcheronUUID>& GetEntities( ) const {
+            return m_is_filtered ? m_filtered : *m_entities;
         };
 
     };
@@ -40,8 +40,11 @@ namespace acs {
     class AcheronComponentViewIterator final {
 
     private:
-        AcheronComponentManager& m_component_manager;
         const std::vector<AcheronUUID>& m_entities;
+        std::tuple<AcheronComponentStorageOf<CompTypes>*...> m_storages;
+        std::array<uint32_t, sizeof...( CompTypes )> m_cursors;
+        std::tuple<AcheronComponentPointer<CompTypes>...> m_components;
+        uint64_t m_version;
         uint32_t m_index;
 
     public:
@@ -59,10 +62,14 @@ namespace acs {
             const std::vector<AcheronUUID>& entities,
             const uint32_t index
         )
-            : m_component_manager{ component_manager },
-            m_entities{ entities },
+            : m_entities{ entities },
+            m_storages{ &component_manager.GetStorage<CompTypes>( )... },
+            m_cursors{ },
+            m_components{ },
+            m_version{ GetVersion( ) },
             m_index{ index }
         {
+            Seek( );
         };
 
         /**
@@ -70,16 +77,52 @@ namespace acs {
          **/
         ~AcheronComponentViewIterator( ) = default;
 
+    private:
+        /**
+         * Seek method
+         * @note : Move each storage cursor to the current entity, entities
+         *         are sorted so cursors only move forward. Cursors restart
+         *         from the storage begining after a structural change.
+         **/
+        void Seek( ) {
+            if ( m_index >= m_entities.size( ) )
+                return;
+
+            if ( const auto version = GetVersion( ); version != m_version ) [[unlikely]] {
+                m_cursors.fill( 0 );
+
+                m_version = version;
+            }
+
+            const auto entity = m_entities[ m_index ];
+
+            [ & ]<size_t... Indices>( std::index_sequence<Indices...> ) -> void {
+                ( ( std::get<Indices>( m_components ) = std::get<Indices>( m_storages )->Seek( entity, m_cursors[ Indices ] ) ), ... );
+            }( std::index_sequence_for<CompTypes...>{ } );
+        };
+
+        /**
+         * GetVersion const function
+         * @note : Get the summed structural version of the iterated 
+         *         storages.
+         * @return Summed storage version as uint64_t.
+         **/
+        uint64_t GetVersion( ) const {
+            return std::apply( []( const auto*... storages ) -> uint64_t { return ( uint64_t( 0 ) + ... + storages->GetVersion( ) ); }, m_storages );
+        };
+
+    public:
         /**
          * Dereferencing operator 
          * @note : Access the current iterator view tuple.
          * @return Tuple to current view iterator entity uuid and components 
-         *         pointers.
+         *         pointers, field references for ACS_Storage_Fields 
+         *         components.
          **/
-        auto operator*( ) -> std::tuple<AcheronUUID, CompTypes*...> {
+        auto operator*( ) -> std::tuple<AcheronUUID, AcheronComponentPointer<CompTypes>...> {
             const auto entity = m_entities[ m_index ];
 
-            return std::make_tuple( entity, m_component_manager.GetComponent<CompTypes>( entity )... );
+            return std::tuple_cat( std::make_tuple( entity ), m_components );
         };
 
         /**
@@ -88,10 +131,10 @@ namespace acs {
          * @return Tuple to current view iterator entity uuid and components
          *         constant pointers.
          **/
-        auto operator*( ) const -> std::tuple<AcheronUUID, const CompTypes*...> {
+        auto operator*( ) const -> std::tuple<AcheronUUID, AcheronComponentPointer<const CompTypes>...> {
             const auto entity = m_entities[ m_index ];
 
-            return std::make_tuple( entity, m_component_manager.GetComponent<CompTypes>( entity )... );
+            return std::tuple_cat( std::make_tuple( entity ), std::tuple<AcheronComponentPointer<const CompTypes>...>{ m_components } );
         };
 
         /**
@@ -102,6 +145,8 @@ namespace acs {
         AcheronComponentViewIterator& operator++( ) {
             ++m_index;
 
+            Seek( );
+
             return *this;
         };
 
@@ -32,7 +32,7 @@
 
 #pragma once
 
-#include "ArcheronTag.h"
+#include "../AcheronComponentView.h"
 
 namespace acs {
 
@@ -54,4 +54,53 @@ namespace acs {
 			Flags |= uint64_t( tag );
 	}
 
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	AcheronTagFilter::AcheronTagFilter( )
+		: AcheronTagFilter{ Tags::ACS_None, Tags::ACS_None, Tags::ACS_None }
+	{
+	}
+
+	AcheronTagFilter::AcheronTagFilter( const uint64_t all, const uint64_t any, const uint64_t none )
+		: All{ all },
+		Any{ any },
+		None{ none }
+	{
+	}
+
+	uint32_t AcheronTagFilter::Scan( std::span<const AcheronTag> tags, std::vector<uint64_t>& mask ) const {
+		const auto count = tags.size( );
+		const auto full  = count / 64;
+		auto matches	 = uint32_t( 0 );
+
+		mask.resize( ( count + 63 ) / 64 );
+
+		for ( auto block = size_t( 0 ); block < mask.size( ); block++ ) {
+			const auto* flags = &tags[ block * 64 ].Flags;
+			const auto length = block < full ? size_t( 64 ) : count % 64;
+			auto bits		  = uint64_t( 0 );
+
+			if ( length == 64 ) {
+				for ( auto index = size_t( 0 ); index < 64; index++ )
+					bits |= uint64_t( GetMatch( flags[ index ] ) ) << index;
+			} else {
+				for ( auto index = size_t( 0 ); index < length; index++ )
+					bits |= uint64_t( GetMatch( flags[ index ] ) ) << index;
+			}
+
+			mask[ block ] = bits;
+			matches		 += uint32_t( std::popcount( bits ) );
+		}
+
+		return matches;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC GET ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	bool AcheronTagFilter::GetIsEmpty( ) const {
+		return ( All | Any | None ) == Tags::ACS_None;
+	}
+
 };
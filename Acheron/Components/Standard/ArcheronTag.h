@@ -32,7 +32,7 @@
 
 #pragma once
 
-#include "../AcheronComponentView.h"
+#include "../AcheronComponentViewIterator.h"
 
 namespace acs {
 
@@ -66,4 +66,53 @@ namespace acs {
 
 	};
 
+	struct ACS_API AcheronTagFilter final {
+
+		uint64_t All;
+		uint64_t Any;
+		uint64_t None;
+
+		/**
+		 * Constructor
+		 **/
+		AcheronTagFilter( );
+
+		/**
+		 * Constructor
+		 * @param all : Flags that must all be set.
+		 * @param any : Flags where at least one must be set, ignored when 0.
+		 * @param none : Flags that must all be cleared.
+		 **/
+		AcheronTagFilter( const uint64_t all, const uint64_t any, const uint64_t none );
+
+		/**
+		 * Scan const method
+		 * @note : Test every tag against the filter and write the result as
+		 *		   a bitmask, one bit per tag index. The loop is branch-free 
+		 *		   so it can be vectorized by the compiler.
+		 * @param tags : Tag span to test, usually the AcheronTag storage.
+		 * @param mask : Bitmask output, resized to hold one bit per tag.
+		 * @return Matching tag count.
+		 **/
+		uint32_t Scan( std::span<const AcheronTag> tags, std::vector<uint64_t>& mask ) const;
+
+		/**
+		 * GetIsEmpty const function
+		 * @note : Get if the filter match any flags value.
+		 * @return True when no flag is filtered.
+		 **/
+		bool GetIsEmpty( ) const;
+
+		/**
+		 * GetMatch inline const function
+		 * @note : Get if a flags value match the filter without branching.
+		 * @param flags : Flags value to test.
+		 * @return True when the flags value match.
+		 **/
+		inline bool GetMatch( const uint64_t flags ) const {
+			return ( ( flags & All ) == All ) & ( ( flags & None ) == 0 ) & ( ( ( flags & Any ) != 0 ) | ( Any == 0 ) );
+		};
+
+	};
+
 };
@@ -38,21 +38,19 @@ namespace acs {
 	//		===	PUBLIC ===
 	////////////////////////////////////////////////////////////////////////////////////////////
 	AcheronEntityManager::AcheronEntityManager( )
-		: m_entities( size_t( acs::StorageSize ) ),
-		m_free_ids( size_t( acs::StorageSize ) ),
-		m_sweep_entities( size_t( StorageSize ) ),
+		: m_entities{ },
+		m_free_ids{ },
+		m_sweep_entities{ },
+		m_reuse_policy{ ACS_Reuse_FIFO },
+		m_free_head{ 0 },
 		m_entity_count{ 0 }
 	{
-		auto iterator_start = m_free_ids.begin( );
-		auto iterator_stop  = m_free_ids.end( );
-
-		std::iota( iterator_start, iterator_stop, 0 );
+		Reallocate( acs::StorageSize );
 	}
 
 	void AcheronEntityManager::Resize( const uint32_t capacity ) {
 		const auto current_capacity = (uint32_t)m_entities.capacity( );
 
-		m_free_ids.clear( );
 		m_sweep_entities.clear( );
 
 		m_entity_count = 0;
@@ -67,34 +65,66 @@ namespace acs {
 	}
 
 	void AcheronEntityManager::Clear( const bool reset_capacity ) {
+		m_entities.clear( );
 		m_free_ids.clear( );
 		m_sweep_entities.clear( );
 
+		m_free_head	   = 0;
 		m_entity_count = 0;
 
 		if ( reset_capacity )
 			Reallocate( acs::StorageSize );
 	}
 
+	void AcheronEntityManager::SetReusePolicy( const AcheronReusePolicies policy ) {
+		if ( policy == ACS_Reuse_LIFO )
+			CompactFreeIds( );
+
+		m_reuse_policy = policy;
+	}
+
 	AcheronUUID AcheronEntityManager::Create( ) {
-		if ( m_free_ids.size( ) == 0 )
-			Expand( );
+		ACS_PROFILE_SCOPE( "AcheronEntityManager::Create" );
 
-		const auto iterator = m_free_ids.begin( );
-		const auto index	= m_free_ids[ 0 ];
+		auto index = uint32_t( 0 );
 
-		m_free_ids.erase( iterator );
+		if ( m_free_head < m_free_ids.size( ) )
+			index = PopFreeId( );
+		else {
+			if ( m_entities.size( ) == m_entities.capacity( ) )
+				Expand( );
+
+			index = uint32_t( m_entities.size( ) );
+
+			m_entities.emplace_back( 0 );
+		}
 
 		m_entity_count += 1;
 
 		return { index, m_entities[ index ] };
 	}
 
+	void AcheronEntityManager::Create( std::span<AcheronUUID> entities ) {
+		ACS_PROFILE_SCOPE( "AcheronEntityManager::CreateRange" );
+
+		const auto free_count = m_free_ids.size( ) - size_t( m_free_head );
+		const auto new_count  = entities.size( ) > free_count ? entities.size( ) - free_count : size_t( 0 );
+		const auto count	  = m_entities.size( ) + new_count;
+
+		if ( count > m_entities.capacity( ) )
+			m_entities.reserve( std::max( count, m_entities.capacity( ) + m_entities.capacity( ) / 2 ) );
+
+		for ( auto& entity : entities )
+			entity = Create( );
+	}
+
 	void AcheronEntityManager::Destroy(
 		const AcheronUUID& entity,
 		const bool use_sweep_destroy
 	) {
-		if ( !entity.GetIsValid( ) )
+		ACS_PROFILE_SCOPE( "AcheronEntityManager::Destroy" );
+
+		if ( !entity.GetIsValid( ) || !GetIsAlive( entity ) )
 			return;
 
 		const auto index = GetIndex( entity );
@@ -109,6 +139,21 @@ namespace acs {
 			m_sweep_entities.emplace_back( entity );
 	}
 
+	void AcheronEntityManager::Destroy(
+		std::span<const AcheronUUID> entities,
+		const bool use_sweep_destroy
+	) {
+		ACS_PROFILE_SCOPE( "AcheronEntityManager::DestroyRange" );
+
+		m_free_ids.reserve( m_free_ids.size( ) + entities.size( ) );
+
+		if ( use_sweep_destroy )
+			m_sweep_entities.reserve( m_sweep_entities.size( ) + entities.size( ) );
+
+		for ( const auto& entity : entities )
+			Destroy( entity, use_sweep_destroy );
+	}
+
 	void AcheronEntityManager::Sweep( ) {
 		m_sweep_entities.clear( );
 	}
@@ -118,35 +163,53 @@ namespace acs {
 	////////////////////////////////////////////////////////////////////////////////////////////
 	void AcheronEntityManager::Reallocate( const uint32_t capacity ) {
 		auto temp_entities = std::vector<AcheronEntity>{ };
-		temp_entities.resize( size_t( capacity ) );
+		temp_entities.reserve( size_t( capacity ) );
 
 		m_entities.swap( temp_entities );
 
 		auto temp_free_ids = std::vector<uint32_t>{ };
-		temp_free_ids.resize( size_t( capacity ) );
+		temp_free_ids.reserve( size_t( capacity ) );
 
 		m_free_ids.swap( temp_free_ids );
 
-		auto iterator_start = m_free_ids.begin( );
-		auto iterator_stop  = m_free_ids.end( );
-
-		std::iota( iterator_start, iterator_stop, 0 );
+		m_free_head = 0;
 	}
 	
 	void AcheronEntityManager::Expand( ) {
-		const auto old_capacity  = m_entities.capacity( );
-		const auto free_capacity = m_free_ids.size( );
-		const auto capacity		 = old_capacity + size_t( acs::StorageOffset );
+		const auto old_capacity = m_entities.capacity( );
+		const auto offset		= std::max( size_t( acs::StorageOffset ), old_capacity / 2 );
 
-		m_entities.resize( capacity, 0 );
+		m_entities.reserve( old_capacity + offset );
+	}
 
-		if ( free_capacity < capacity )
-			m_free_ids.resize( free_capacity + size_t( acs::StorageOffset ) );
-		
+	uint32_t AcheronEntityManager::PopFreeId( ) {
+		if ( m_reuse_policy == ACS_Reuse_LIFO ) {
+			const auto index = m_free_ids.back( );
+
+			m_free_ids.pop_back( );
+
+			return index;
+		}
+
+		const auto index = m_free_ids[ m_free_head++ ];
+
+		if ( m_free_head == m_free_ids.size( ) ) {
+			m_free_ids.clear( );
+
+			m_free_head = 0;
+		} else if ( m_free_head >= acs::StorageOffset && m_free_head * 2 >= m_free_ids.size( ) )
+			CompactFreeIds( );
+
+		return index;
+	}
+
+	void AcheronEntityManager::CompactFreeIds( ) {
 		auto iterator_start = m_free_ids.begin( );
-		auto iterator_stop  = m_free_ids.end( );
+		auto iterator_stop  = iterator_start + m_free_head;
+
+		m_free_ids.erase( iterator_start, iterator_stop );
 
-		std::iota( iterator_start, iterator_stop, uint32_t( old_capacity ) );
+		m_free_head = 0;
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,10 +219,14 @@ namespace acs {
 		return m_entity_count;
 	}
 	
+	AcheronReusePolicies AcheronEntityManager::GetReusePolicy( ) const {
+		return m_reuse_policy;
+	}
+
 	bool AcheronEntityManager::GetIsAlive( const AcheronUUID& entity ) const {
 		const auto index = GetIndex( entity );
 
-		return m_entities[ index ] == uint32_t( entity.Value >> 32 );
+		return index < m_entities.size( ) && m_entities[ index ] == uint32_t( entity.Value >> 32 );
 	}
 
 	const std::vector<AcheronUUID>& AcheronEntityManager::GetSweeEntities( ) const {
@@ -38,12 +38,21 @@ namespace acs {
 
 	typedef uint32_t AcheronEntity;
 
+	enum AcheronReusePolicies : uint32_t {
+
+		ACS_Reuse_FIFO = 0,
+		ACS_Reuse_LIFO
+
+	};
+
 	class ACS_API AcheronEntityManager final {
 
 	private:
 		std::vector<AcheronEntity> m_entities;
 		std::vector<uint32_t> m_free_ids;
 		std::vector<AcheronUUID> m_sweep_entities;
+		AcheronReusePolicies m_reuse_policy;
+		uint32_t m_free_head;
 		uint32_t m_entity_count;
 
 	public:
@@ -71,13 +80,31 @@ namespace acs {
 		 **/
 		void Clear( const bool reset_capacity );
 
+		/**
+		 * SetReusePolicy method
+		 * @note : Set the order destroyed entity indices are reused in,
+		 *		   FIFO let indices age the longest before reuse while LIFO
+		 *		   reuse the hottest index first.
+		 * @param policy : New reuse policy.
+		 **/
+		void SetReusePolicy( const AcheronReusePolicies policy );
+
 		/**
 		 * Create function
-		 * @note : Create an new entity.
+		 * @note : Create an new entity, destroyed indices are reused first 
+		 *		   in O(1) according to the reuse policy.
 		 * @return Return new entity uuid.
 		 **/
 		AcheronUUID Create( );
 
+		/**
+		 * Create method
+		 * @note : Create one entity per span element, storage is reserved
+		 *		   once for the whole range.
+		 * @param entities : Span receiving the new entities uuids.
+		 **/
+		void Create( std::span<AcheronUUID> entities );
+
 		/**
 		 * Destroy method
 		 * @note : Destroy an entity using is uuid.
@@ -86,6 +113,14 @@ namespace acs {
 		 **/
 		void Destroy( const AcheronUUID& entity, const bool use_sweep_destroy );
 
+		/**
+		 * Destroy method
+		 * @note : Destroy a range of entities.
+		 * @param entities : Entities uuids to destroy.
+		 * @param use_sweep_destroy : True to use sweep destroy on the entities.
+		 **/
+		void Destroy( std::span<const AcheronUUID> entities, const bool use_sweep_destroy );
+
 		/**
 		 * Sweep method
 		 * @note : Clear the defered entity destruction vector.
@@ -103,11 +138,27 @@ namespace acs {
 
 		/**
 		 * Expand method
-		 * @note : Expand internal vector by acs::StorageOffset when 
-		 *		   the actual vectors can't hold more entities.
+		 * @note : Expand internal vector by half is capacity, at least by
+		 *		   acs::StorageOffset, when the actual vectors can't hold 
+		 *		   more entities.
 		 **/
 		void Expand( );
 
+		/**
+		 * PopFreeId function
+		 * @note : Pop the next free entity index according to the reuse 
+		 *		   policy, FIFO consume the free list from a head offset 
+		 *		   compacted once half of the list is consumed.
+		 * @return Free entity index.
+		 **/
+		uint32_t PopFreeId( );
+
+		/**
+		 * CompactFreeIds method
+		 * @note : Erase consumed free entity indices before the head offset.
+		 **/
+		void CompactFreeIds( );
+
 	public:
 		/**
 		 * GetCount const function
@@ -116,6 +167,13 @@ namespace acs {
 		 **/
 		uint32_t GetCount( ) const;
 
+		/**
+		 * GetReusePolicy const function
+		 * @note : Get current destroyed entity indices reuse policy.
+		 * @return Current reuse policy.
+		 **/
+		AcheronReusePolicies GetReusePolicy( ) const;
+
 		/**
 		 * GetIsAlive function
 		 * @note : Check if an entity is alive.
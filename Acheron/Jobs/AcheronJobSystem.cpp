@@ -0,0 +1,369 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "_acheron_pch.h"
+
+namespace acs {
+
+    // Job system owning the current worker thread and its queue index.
+    static thread_local const AcheronJobSystem* s_worker_system = nullptr;
+    static thread_local uint32_t s_worker_index = 0;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    AcheronJob::AcheronJob( )
+        : Function{ },
+        Counter{ nullptr }
+    {
+    }
+
+    AcheronJob::AcheronJob( std::function<void( )>&& function, AcheronJobCounter* counter )
+        : Function{ std::move( function ) },
+        Counter{ counter }
+    {
+    }
+
+    AcheronJobCounter::AcheronJobCounter( )
+        : Value{ 0 },
+        Mutex{ },
+        Continuations{ }
+    {
+    }
+
+    bool AcheronJobCounter::GetIsDone( ) const {
+        return Value.load( std::memory_order_acquire ) == 0;
+    }
+
+    AcheronJobSystem::AcheronJobSystem( )
+        : m_queues{ },
+        m_workers{ },
+        m_sleep_mutex{ },
+        m_sleep_condition{ },
+        m_queued_jobs{ 0 },
+        m_sleeping_workers{ 0 },
+        m_waiting_threads{ 0 },
+        m_is_running{ false }
+    {
+        Resize( 0 );
+    }
+
+    AcheronJobSystem::~AcheronJobSystem( ) {
+        Stop( );
+    }
+
+    void AcheronJobSystem::Resize( const uint32_t worker_count ) {
+        Stop( );
+
+        m_queues.clear( );
+
+        // Last queue is shared by the threads that aren't workers.
+        for ( auto index = uint32_t( 0 ); index < worker_count + 1; index++ )
+            m_queues.emplace_back( std::make_unique<WorkerQueue>( ) );
+
+        m_queued_jobs.store( 0 );
+        m_is_running.store( true );
+
+        m_workers.reserve( size_t( worker_count ) );
+
+        for ( auto index = uint32_t( 0 ); index < worker_count; index++ )
+            m_workers.emplace_back( [ this, index ]( ) { WorkerLoop( index ); } );
+    }
+
+    void AcheronJobSystem::Schedule( std::function<void( )> function, AcheronJobCounter* counter ) {
+        if ( counter )
+            counter->Value.fetch_add( 1, std::memory_order_relaxed );
+
+        auto job = AcheronJob{ std::move( function ), counter };
+
+        if ( m_workers.empty( ) )
+            Run( job );
+        else
+            Push( std::move( job ) );
+    }
+
+    void AcheronJobSystem::Schedule(
+        std::function<void( )> function,
+        AcheronJobCounter* counter,
+        AcheronJobCounter& dependency
+    ) {
+        if ( counter )
+            counter->Value.fetch_add( 1, std::memory_order_relaxed );
+
+        auto job = AcheronJob{ std::move( function ), counter };
+
+        {
+            auto lock = std::unique_lock{ dependency.Mutex };
+
+            if ( !dependency.GetIsDone( ) ) {
+                dependency.Continuations.emplace_back( std::move( job ) );
+
+                return;
+            }
+        }
+
+        if ( m_workers.empty( ) )
+            Run( job );
+        else
+            Push( std::move( job ) );
+    }
+
+    void AcheronJobSystem::WaitFor( AcheronJobCounter& counter ) {
+        const auto index = GetQueueIndex( );
+        auto job = AcheronJob{ };
+
+        while ( !counter.GetIsDone( ) ) {
+            if ( TryPop( index, job ) ) {
+                Run( job );
+
+                continue;
+            }
+
+            // Waiting threads sleep like workers, they are woken by pushed
+            // jobs or by the last job of a counter.
+            m_sleeping_workers.fetch_add( 1 );
+            m_waiting_threads.fetch_add( 1 );
+
+            {
+                auto lock = std::unique_lock{ m_sleep_mutex };
+
+                m_sleep_condition.wait( lock, [ this, &counter ]( ) { 
+                    return counter.GetIsDone( ) || m_queued_jobs.load( ) > 0; 
+                } );
+            }
+
+            m_waiting_threads.fetch_sub( 1 );
+            m_sleeping_workers.fetch_sub( 1 );
+        }
+
+        auto lock = std::unique_lock{ counter.Mutex };
+    }
+
+    void AcheronJobSystem::ParallelFor(
+        const uint32_t count,
+        const uint32_t grain,
+        const std::function<void( uint32_t, uint32_t )>& function
+    ) {
+        const auto step = std::max( grain, uint32_t( 1 ) );
+
+        if ( m_workers.empty( ) || count <= step ) {
+            if ( count > 0 )
+                function( 0, count );
+
+            return;
+        }
+
+        auto counter = AcheronJobCounter{ };
+
+        for ( auto start = uint32_t( 0 ); start < count; start += step ) {
+            const auto stop = std::min( count, start + step );
+
+            Schedule( [ &function, start, stop ]( ) { function( start, stop ); }, &counter );
+        }
+
+        WaitFor( counter );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PRIVATE ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    void AcheronJobSystem::Stop( ) {
+        {
+            auto lock = std::unique_lock{ m_sleep_mutex };
+
+            m_is_running.store( false );
+        }
+
+        m_sleep_condition.notify_all( );
+
+        for ( auto& worker : m_workers )
+            worker.join( );
+
+        m_workers.clear( );
+    }
+
+    void AcheronJobSystem::WorkerLoop( const uint32_t index ) {
+        auto job = AcheronJob{ };
+
+        s_worker_system = this;
+        s_worker_index  = index;
+
+        while ( m_is_running.load( std::memory_order_relaxed ) ) {
+            if ( TryPop( index, job ) ) {
+                Run( job );
+
+                continue;
+            }
+
+            // Sleeping count is published before the queue check so a 
+            // pushing thread either see the sleeper or the sleeper see
+            // the job.
+            m_sleeping_workers.fetch_add( 1 );
+
+            {
+                auto lock = std::unique_lock{ m_sleep_mutex };
+
+                m_sleep_condition.wait( lock, [ this ]( ) { 
+                    return m_queued_jobs.load( ) > 0 || !m_is_running.load( ); 
+                } );
+            }
+
+            m_sleeping_workers.fetch_sub( 1 );
+        }
+
+        s_worker_system = nullptr;
+    }
+
+    void AcheronJobSystem::Push( AcheronJob&& job ) {
+        auto& queue = *m_queues[ GetQueueIndex( ) ];
+
+        {
+            auto lock = std::unique_lock{ queue.Mutex };
+
+            queue.Jobs.emplace_back( std::move( job ) );
+        }
+
+        m_queued_jobs.fetch_add( 1 );
+
+        if ( m_sleeping_workers.load( ) > 0 ) {
+            { auto lock = std::unique_lock{ m_sleep_mutex }; }
+
+            m_sleep_condition.notify_one( );
+        }
+    }
+
+    bool AcheronJobSystem::TryPop( const uint32_t index, AcheronJob& job ) {
+        if ( m_queued_jobs.load( std::memory_order_relaxed ) == 0 )
+            return false;
+
+        const auto queue_count = uint32_t( m_queues.size( ) );
+
+        for ( auto offset = uint32_t( 0 ); offset < queue_count; offset++ ) {
+            const auto queue_index = ( index + offset ) % queue_count;
+            auto& queue = *m_queues[ queue_index ];
+            auto lock   = std::unique_lock{ queue.Mutex };
+
+            if ( queue.Jobs.empty( ) )
+                continue;
+
+            // Own queue is used as a stack for cache locality, thieves take
+            // the oldest jobs.
+            if ( offset == 0 ) {
+                job = std::move( queue.Jobs.back( ) );
+
+                queue.Jobs.pop_back( );
+            } else {
+                job = std::move( queue.Jobs.front( ) );
+
+                queue.Jobs.pop_front( );
+            }
+
+            m_queued_jobs.fetch_sub( 1 );
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void AcheronJobSystem::Run( AcheronJob& job ) {
+        std::invoke( job.Function );
+
+        auto* counter = job.Counter;
+
+        job = AcheronJob{ };
+
+        if ( !counter )
+            return;
+
+        auto value = counter->Value.load( std::memory_order_relaxed );
+
+        while ( value > 1 ) {
+            if ( counter->Value.compare_exchange_weak( value, value - 1, std::memory_order_acq_rel ) )
+                return;
+        }
+
+        // Last decrement is done under the counter lock, WaitFor take the 
+        // lock before returning so the counter outlive this scope.
+        auto continuations = std::vector<AcheronJob>{ };
+        auto is_done       = false;
+
+        {
+            auto lock = std::unique_lock{ counter->Mutex };
+
+            is_done = counter->Value.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+
+            if ( is_done )
+                std::swap( continuations, counter->Continuations );
+        }
+
+        // Waiting threads check the counter under the sleep lock, taking it
+        // once the counter is done ensure none miss the notification.
+        if ( is_done ) {
+            auto is_waiting = false;
+
+            {
+                auto lock = std::unique_lock{ m_sleep_mutex };
+
+                is_waiting = m_waiting_threads.load( ) > 0;
+            }
+
+            if ( is_waiting )
+                m_sleep_condition.notify_all( );
+        }
+
+        for ( auto& continuation : continuations ) {
+            if ( m_workers.empty( ) )
+                Run( continuation );
+            else
+                Push( std::move( continuation ) );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC GET ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t AcheronJobSystem::GetWorkerCount( ) const {
+        return uint32_t( m_workers.size( ) );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PRIVATE GET ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t AcheronJobSystem::GetQueueIndex( ) const {
+        if ( s_worker_system == this )
+            return s_worker_index;
+
+        return uint32_t( m_queues.size( ) - 1 );
+    }
+
+};
@@ -0,0 +1,229 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "../Utils/AcheronTraits.h"
+
+namespace acs {
+
+    struct AcheronJobCounter;
+
+    struct ACS_API AcheronJob {
+
+        std::function<void( )> Function;
+        AcheronJobCounter* Counter;
+
+        /**
+         * Constructor
+         **/
+        AcheronJob( );
+
+        /**
+         * Constructor
+         * @param function : Job function.
+         * @param counter : Counter decremented once the job is done, can be
+         *                  nullptr.
+         **/
+        AcheronJob( std::function<void( )>&& function, AcheronJobCounter* counter );
+
+    };
+
+    struct ACS_API AcheronJobCounter {
+
+        std::atomic<uint32_t> Value;
+        std::mutex Mutex;
+        std::vector<AcheronJob> Continuations;
+
+        /**
+         * Constructor
+         **/
+        AcheronJobCounter( );
+
+        /**
+         * GetIsDone const function
+         * @note : Get if every job attached to the counter is done.
+         * @return True when the counter reached zero.
+         **/
+        bool GetIsDone( ) const;
+
+    };
+
+    class ACS_API AcheronJobSystem final {
+
+        struct WorkerQueue {
+
+            std::mutex Mutex;
+            std::deque<AcheronJob> Jobs;
+
+        };
+
+    private:
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_sleep_condition;
+        std::atomic<uint32_t> m_queued_jobs;
+        std::atomic<uint32_t> m_sleeping_workers;
+        std::atomic<uint32_t> m_waiting_threads;
+        std::atomic<bool> m_is_running;
+
+    public:
+        /**
+         * Constructor
+         **/
+        AcheronJobSystem( );
+
+        /**
+         * Destructor
+         **/
+        ~AcheronJobSystem( );
+
+        /**
+         * Resize method
+         * @note : Stop current workers and start worker_count new workers,
+         *         with zero workers jobs run on the scheduling thread. Must 
+         *         not be called while jobs are in flight.
+         * @param worker_count : New worker thread count.
+         **/
+        void Resize( const uint32_t worker_count );
+
+        /**
+         * Schedule method
+         * @note : Schedule a job, workers push on their own queue and other
+         *         threads on the shared external queue.
+         * @param function : Job function.
+         * @param counter : Counter incremented now and decremented once the
+         *                  job is done, can be nullptr.
+         **/
+        void Schedule( std::function<void( )> function, AcheronJobCounter* counter );
+
+        /**
+         * Schedule method
+         * @note : Schedule a job once every job of the dependency counter
+         *         is done.
+         * @param function : Job function.
+         * @param counter : Counter incremented now and decremented once the
+         *                  job is done, can be nullptr.
+         * @param dependency : Reference to the counter the job wait for.
+         **/
+        void Schedule(
+            std::function<void( )> function,
+            AcheronJobCounter* counter,
+            AcheronJobCounter& dependency
+        );
+
+        /**
+         * WaitFor method
+         * @note : Wait for a counter to reach zero, the waiting thread run
+         *         queued jobs meanwhile and sleeps with the workers when
+         *         every queue is empty. The counter can be destroyed once
+         *         WaitFor returned.
+         * @param counter : Reference to the counter to wait for.
+         **/
+        void WaitFor( AcheronJobCounter& counter );
+
+        /**
+         * ParallelFor method
+         * @note : Split [ 0, count [ in ranges of grain elements processed
+         *         as jobs and wait for them.
+         * @param count : Element count.
+         * @param grain : Maximum element count per job.
+         * @param function : Range function taking [ start, stop [.
+         **/
+        void ParallelFor(
+            const uint32_t count,
+            const uint32_t grain,
+            const std::function<void( uint32_t, uint32_t )>& function
+        );
+
+    private:
+        /**
+         * Stop method
+         * @note : Stop and join all workers, queued jobs are dropped.
+         **/
+        void Stop( );
+
+        /**
+         * WorkerLoop method
+         * @note : Worker thread entry, run jobs and sleep when every queue
+         *         is empty.
+         * @param index : Worker queue index.
+         **/
+        void WorkerLoop( const uint32_t index );
+
+        /**
+         * Push method
+         * @note : Push a ready job on the current thread queue and wake a 
+         *         sleeping worker.
+         * @param job : Job to push.
+         **/
+        void Push( AcheronJob&& job );
+
+        /**
+         * TryPop function
+         * @note : Pop a job from the queue at index back or steal one from
+         *         the front of another queue.
+         * @param index : Queue index of the current thread.
+         * @param job : Reference to the popped job.
+         * @return True when a job was popped.
+         **/
+        bool TryPop( const uint32_t index, AcheronJob& job );
+
+        /**
+         * Run method
+         * @note : Run a job, decrement its counter and schedule the counter
+         *         continuations when it reach zero.
+         * @param job : Reference to the job to run.
+         **/
+        void Run( AcheronJob& job );
+
+    public:
+        /**
+         * GetWorkerCount const function
+         * @note : Get current worker thread count.
+         * @return Worker thread count as uint32_t.
+         **/
+        uint32_t GetWorkerCount( ) const;
+
+    private:
+        /**
+         * GetQueueIndex const function
+         * @note : Get the current thread queue index, threads that aren't
+         *         workers of this job system use the external queue.
+         * @return Queue index as uint32_t.
+         **/
+        uint32_t GetQueueIndex( ) const;
+
+    };
+
+};
@@ -0,0 +1,367 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronStaticSystem.h"
+
+namespace acs {
+
+	template<typename SysType, typename... SysTypes>
+	class AcheronFuse final {
+
+		/**
+		 * MutableComponents struct
+		 * @note : Remove const qualifier from a component tuple.
+		 **/
+		template<typename Tuple>
+		struct MutableComponents;
+
+		template<typename... CompTypes>
+		struct MutableComponents<std::tuple<CompTypes...>> {
+
+			using Type = std::tuple<std::remove_const_t<CompTypes>...>;
+
+		};
+
+	public:
+		using Components = typename MutableComponents<typename SysType::Components>::Type;
+
+		// Fused loops are parallel only when every system is parallel.
+		static constexpr uint32_t ParallelGrain = ( ( SysType::ParallelGrain > 0 ) && ... && ( SysTypes::ParallelGrain > 0 ) )
+			? std::max( { SysType::ParallelGrain, SysTypes::ParallelGrain... } )
+			: 0;
+
+		// Entity count processed by every system before moving to the next
+		// block, small enough to keep block components in cache.
+		static constexpr size_t BlockSize = 1024;
+
+	private:
+		std::tuple<SysType, SysTypes...> m_systems;
+		uint32_t m_processed_count;
+
+	public:
+		/**
+		 * Constructor
+		 **/
+		AcheronFuse( )
+			: m_systems{ },
+			m_processed_count{ 0 }
+		{
+			static_assert( 
+				GetIsFusable( (typename SysType::Components*)nullptr ) && ( GetIsFusable( (typename SysTypes::Components*)nullptr ) && ... ),
+				"Fused systems must use the same component types."
+			);
+		};
+
+		/**
+		 * Destructor
+		 **/
+		~AcheronFuse( ) = default;
+
+		/**
+		 * Prepare method
+		 * @note : Update the fused view cache.
+		 * @param context : Reference to current acheron context instance.
+		 **/
+		void Prepare( AcheronContext& context ) {
+			Prepare( context, (Components*)nullptr );
+		};
+
+		/**
+		 * Process method
+		 * @note : Iterate the shared view once, each run is split in blocks
+		 *		   processed by every system in declaration order. Systems
+		 *		   must only depend on the components of the entity they 
+		 *		   process, since a system can see an entity before the 
+		 *		   previous system processed every other entity.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 **/
+		void Process( AcheronContext& context, void* user_data ) {
+			Process( context, user_data, (Components*)nullptr );
+		};
+
+		/**
+		 * ProcessBatch method
+		 * @note : Process a run of entities with every system, used when
+		 *		   the fused system is itself part of a pipeline.
+		 * @template Spans : Fused component span types.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 * @param entities : Run entity uuid's.
+		 * @param components : Run components, one span per component type.
+		 **/
+		template<typename... Spans>
+		void ProcessBatch(
+			AcheronContext& context,
+			void* user_data,
+			std::span<const AcheronUUID> entities,
+			Spans... components
+		) {
+			const auto spans = std::make_tuple( components... );
+
+			for ( auto start = size_t( 0 ); start < entities.size( ); start += BlockSize ) {
+				const auto count  = std::min( BlockSize, entities.size( ) - start );
+				const auto block = entities.subspan( start, count );
+
+				std::apply( [ & ]( auto&... systems ) -> void {
+					( ProcessBlock( systems, context, user_data, block, spans, start, (typename std::remove_reference_t<decltype( systems )>::Components*)nullptr ), ... );
+				}, m_systems );
+			}
+		};
+
+		/**
+		 * GetAccess static function
+		 * @note : Get the components accessed by every fused system.
+		 * @return Fused systems component access.
+		 **/
+		static AcheronSystemAccess GetAccess( ) {
+			auto access = SysType::GetAccess( );
+
+			( access.Merge( SysTypes::GetAccess( ) ), ... );
+
+			return access;
+		};
+
+		/**
+		 * GetProcessedCount const function
+		 * @note : Get the fused view entry count of the last Process call.
+		 * @return Processed entity count as uint32_t.
+		 **/
+		uint32_t GetProcessedCount( ) const {
+			return m_processed_count;
+		};
+
+		/**
+		 * Get template function
+		 * @note : Get a fused system.
+		 * @template Type : System type.
+		 * @return Reference to the system.
+		 **/
+		template<typename Type>
+		Type& Get( ) {
+			return std::get<Type>( m_systems );
+		};
+
+	private:
+		/**
+		 * Prepare template method
+		 * @note : Update the fused view cache.
+		 * @template CompTypes : Fused component types.
+		 * @param context : Reference to current acheron context instance.
+		 **/
+		template<typename... CompTypes>
+		void Prepare( AcheronContext& context, std::tuple<CompTypes...>* ) {
+			auto& component_cache = context.GetComponentCache( );
+
+			component_cache.Get<CompTypes...>( context );
+		};
+
+		/**
+		 * Process template method
+		 * @note : Iterate the fused view by runs. Fused systems share the
+		 *		   run spans, viewed storages stay locked so a structural
+		 *		   change from a fused system hit the storage assert.
+		 * @template CompTypes : Fused component types.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 **/
+		template<typename... CompTypes>
+		void Process( AcheronContext& context, void* user_data, std::tuple<CompTypes...>* ) {
+			auto view  = AcheronComponentView<CompTypes...>( context, context );
+			auto batch = [ & ]( std::span<const AcheronUUID> entities, AcheronComponentSpan<CompTypes>... components ) -> void {
+				ProcessBatch( context, user_data, entities, components... );
+			};
+
+			m_processed_count = view.GetCount( );
+
+			if constexpr ( ParallelGrain > 0 )
+				view.ParallelEachBatch( batch, ParallelGrain );
+			else {
+				( context.GetStorage<CompTypes>( ).Lock( ), ... );
+
+				view.EachBatch( batch );
+
+				( context.GetStorage<CompTypes>( ).Unlock( ), ... );
+			}
+		};
+
+		/**
+		 * ProcessBlock template method
+		 * @note : Process a block of a run with a single system, fused spans
+		 *		   are converted to the system component types.
+		 * @template System : System type.
+		 * @template Spans : Fused component span types.
+		 * @template SysCompTypes : System component types.
+		 * @param system : Reference to the system.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 * @param entities : Block entity uuid's.
+		 * @param spans : Run component spans.
+		 * @param start : Block start in the run.
+		 **/
+		template<typename System, typename... Spans, typename... SysCompTypes>
+		static void ProcessBlock(
+			System& system,
+			AcheronContext& context,
+			void* user_data,
+			std::span<const AcheronUUID> entities,
+			const std::tuple<Spans...>& spans,
+			const size_t start,
+			std::tuple<SysCompTypes...>*
+		) {
+			const auto count = entities.size( );
+
+			system.ProcessBatch( 
+				context, user_data, entities, 
+				AcheronComponentSpan<SysCompTypes>{ std::get<AcheronComponentSpan<std::remove_const_t<SysCompTypes>>>( spans ).subspan( start, count ) }... 
+			);
+		};
+
+		/**
+		 * GetIsFusable static function
+		 * @note : Get if a system component list match the fused one, 
+		 *		   ignoring const qualifiers.
+		 * @template CompTypes : System component types.
+		 * @return True when the component lists match.
+		 **/
+		template<typename... CompTypes>
+		static constexpr bool GetIsFusable( std::tuple<CompTypes...>* ) {
+			return sizeof...( CompTypes ) == std::tuple_size_v<Components>
+				&& ( GetHasComponent<std::remove_const_t<CompTypes>>( (Components*)nullptr ) && ... );
+		};
+
+		/**
+		 * GetHasComponent static function
+		 * @note : Get if a component type is part of a component list.
+		 * @template CompType : Component type.
+		 * @template CompTypes : Component list types.
+		 * @return True when the component is in the list.
+		 **/
+		template<typename CompType, typename... CompTypes>
+		static constexpr bool GetHasComponent( std::tuple<CompTypes...>* ) {
+			return ( std::is_same_v<CompType, CompTypes> || ... );
+		};
+
+	};
+
+	template<typename... SysTypes>
+	class AcheronPipeline final 
+		: public IAcheronSystem
+	{
+
+	private:
+		std::tuple<SysTypes...> m_systems;
+
+	public:
+		/**
+		 * Constructor
+		 **/
+		AcheronPipeline( )
+			: m_systems{ }
+		{ };
+
+		/**
+		 * Destructor
+		 **/
+		virtual ~AcheronPipeline( ) = default;
+
+		/**
+		 * Prepare override method
+		 * @note : Update every system view cache.
+		 * @param context : Reference to current acheron context instance.
+		 **/
+		virtual void Prepare( AcheronContext& context ) override {
+			std::apply( [ & ]( auto&... systems ) -> void {
+				( systems.Prepare( context ), ... );
+			}, m_systems );
+		};
+
+		/**
+		 * Process override method
+		 * @note : Process every system in declaration order, system calls
+		 *		   are resolved at compile time. Calling it on the pipeline
+		 *		   type directly skip the virtual call too.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 **/
+		virtual void Process( AcheronContext& context, void* user_data ) override {
+			std::apply( [ & ]( auto&... systems ) -> void {
+				( systems.Process( context, user_data ), ... );
+			}, m_systems );
+		};
+
+		/**
+		 * GetAccess const override function
+		 * @note : Get the components accessed by every pipeline system.
+		 * @return Pipeline component access.
+		 **/
+		virtual AcheronSystemAccess GetAccess( ) const override {
+			auto access = AcheronSystemAccess{ };
+
+			( access.Merge( SysTypes::GetAccess( ) ), ... );
+
+			return access;
+		};
+
+		/**
+		 * GetProcessedCount const override function
+		 * @note : Get the entity count of the last Process call summed over
+		 *		   every pipeline system.
+		 * @return Processed entity count as uint32_t.
+		 **/
+		virtual uint32_t GetProcessedCount( ) const override {
+			return std::apply( [ ]( const auto&... systems ) -> uint32_t {
+				return ( systems.GetProcessedCount( ) + ... + 0 );
+			}, m_systems );
+		};
+
+		/**
+		 * Get template function
+		 * @note : Get a pipeline system.
+		 * @template SysType : System type.
+		 * @return Reference to the system.
+		 **/
+		template<typename SysType>
+		SysType& Get( ) {
+			return std::get<SysType>( m_systems );
+		};
+
+	};
+
+};
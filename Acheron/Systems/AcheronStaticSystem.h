@@ -0,0 +1,176 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronSystem.h"
+
+namespace acs {
+
+	template<typename Derived, typename... CompTypes>
+	class AcheronStaticSystem {
+
+	public:
+		using Components = std::tuple<CompTypes...>;
+
+		// Minimum entity count per job, 0 to process entities serially. 
+		// Shadow it in the derived system to process entities in parallel.
+		static constexpr uint32_t ParallelGrain = 0;
+
+	private:
+		uint32_t m_processed_count = 0;
+
+	public:
+		/**
+		 * Constructor
+		 **/
+		AcheronStaticSystem( ) = default;
+
+		/**
+		 * Destructor
+		 **/
+		~AcheronStaticSystem( ) = default;
+
+		/**
+		 * Prepare method
+		 * @note : Update the system view cache so concurrent systems only 
+		 *		   read it.
+		 * @param context : Reference to current acheron context instance.
+		 **/
+		void Prepare( AcheronContext& context ) {
+			auto& component_cache = context.GetComponentCache( );
+
+			component_cache.Get<CompTypes...>( context );
+		};
+
+		/**
+		 * Process method
+		 * @note : Process the system component group, OnProcessBatch and 
+		 *		   OnProcess are resolved on the derived system at compile 
+		 *		   time so they can be inlined.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 **/
+		void Process( AcheronContext& context, void* user_data ) {
+			auto view  = AcheronComponentView<CompTypes...>( context, context );
+			auto batch = [ & ]( std::span<const AcheronUUID> entities, AcheronComponentSpan<CompTypes>... components ) -> void {
+				ProcessBatch( context, user_data, entities, components... );
+			};
+
+			m_processed_count = view.GetCount( );
+
+			if constexpr ( Derived::ParallelGrain > 0 )
+				view.ParallelEachBatch( batch, Derived::ParallelGrain );
+			else
+				view.EachBatch( batch );
+		};
+
+		/**
+		 * ProcessBatch method
+		 * @note : Process a run of entities whose components are contiguous
+		 *		   in every storage.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 * @param entities : Run entity uuid's.
+		 * @param components : Run components, one span per component type.
+		 **/
+		void ProcessBatch(
+			AcheronContext& context,
+			void* user_data,
+			std::span<const AcheronUUID> entities,
+			AcheronComponentSpan<CompTypes>... components
+		) {
+			auto& system = static_cast<Derived&>( *this );
+
+			system.OnProcessBatch( context, user_data, entities, components... );
+		};
+
+		/**
+		 * OnProcessBatch method
+		 * @note : Default batch hook calling OnProcess for each entity, 
+		 *		   hide it in the derived system to process the whole run. 
+		 *		   Derived hooks must be public and must not Append, Remove
+		 *		   or Destroy viewed components, the default falls back to
+		 *		   a per entity lookup once OnProcess did one.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 * @param entities : Run entity uuid's.
+		 * @param components : Run components, one span per component type.
+		 **/
+		void OnProcessBatch(
+			AcheronContext& context,
+			void* user_data,
+			std::span<const AcheronUUID> entities,
+			AcheronComponentSpan<CompTypes>... components
+		) {
+			auto& system	   = static_cast<Derived&>( *this );
+			const auto version = context.GetStructureVersion<CompTypes...>( );
+			auto index		   = size_t( 0 );
+
+			for ( ; index < entities.size( ) && context.GetStructureVersion<CompTypes...>( ) == version; index++ ) {
+				auto entity_components = std::tuple<AcheronUUID, AcheronComponentPointer<CompTypes>...>{ entities[ index ], GetComponentAt( components, index )... };
+
+				system.OnProcess( context, user_data, entity_components );
+			}
+
+			for ( ; index < entities.size( ); index++ ) {
+				auto entity_components = std::tuple<AcheronUUID, AcheronComponentPointer<CompTypes>...>{ entities[ index ], context.GetComponent<CompTypes>( entities[ index ] )... };
+
+				system.OnProcess( context, user_data, entity_components );
+			}
+		};
+
+		/**
+		 * GetAccess static function
+		 * @note : Get the components accessed by the system, const component
+		 *		   types are read and other types are written.
+		 * @return System component access.
+		 **/
+		static AcheronSystemAccess GetAccess( ) {
+			return AcheronSystemAccess::Make<CompTypes...>( );
+		};
+
+		/**
+		 * GetProcessedCount const function
+		 * @note : Get the view entry count of the last Process call.
+		 * @return Processed entity count as uint32_t.
+		 **/
+		uint32_t GetProcessedCount( ) const {
+			return m_processed_count;
+		};
+
+	};
+
+};
@@ -32,12 +32,36 @@
 
 #pragma once
 
-#include "AcheronSystemContext.h"
+#include "AcheronSystemAccess.h"
 
 namespace acs {
 
 	struct IAcheronSystem {
 
+		/**
+		 * Destructor
+		 **/
+		virtual ~IAcheronSystem( ) = default;
+
+		/**
+		 * Prepare virtual method
+		 * @note : Prepare shared state before the system is processed 
+		 *		   concurrently with other systems, called on the scheduling
+		 *		   thread.
+		 * @param context : Reference to current acheron context instance.
+		 **/
+		virtual void Prepare( AcheronContext& ) { };
+
+		/**
+		 * GetAccess const virtual function
+		 * @note : Get the components accessed by the system, systems that
+		 *		   don't declare their access are exclusive.
+		 * @return System component access.
+		 **/
+		virtual AcheronSystemAccess GetAccess( ) const {
+			return { true };
+		};
+
 		/**
 		 * Process pure-virtual method
 		 * @note : Process the system component group.
@@ -47,6 +71,16 @@ namespace acs {
 		 **/
 		virtual void Process( AcheronContext& context, void* user_data ) = 0;
 
+		/**
+		 * GetProcessedCount const virtual function
+		 * @note : Get the entity count handled by the last Process call,
+		 *		   used by the system manager profiling.
+		 * @return Processed entity count as uint32_t.
+		 **/
+		virtual uint32_t GetProcessedCount( ) const {
+			return 0;
+		};
+
 	};
 
 	template<typename... CompTypes>
@@ -54,11 +88,47 @@ namespace acs {
 		: public IAcheronSystem
 	{
 
+	protected:
+		uint32_t m_parallel_grain;
+		uint32_t m_processed_count;
+		AcheronTagFilter m_tag_filter;
+
 	public:
 		/**
 		 * Constructor
 		 **/
-		AcheronSystem( ) = default;
+		AcheronSystem( )
+			: AcheronSystem{ 0 }
+		{ };
+
+		/**
+		 * Constructor
+		 * @param parallel_grain : Minimum entity count per job when the 
+		 *						   system entities are processed in parallel,
+		 *						   0 to process them serially. OnProcess must 
+		 *						   only write to its own entity components 
+		 *						   when the system is parallel.
+		 **/
+		AcheronSystem( const uint32_t parallel_grain )
+			: AcheronSystem{ parallel_grain, AcheronTagFilter{ } }
+		{ };
+
+		/**
+		 * Constructor
+		 * @param parallel_grain : Minimum entity count per job when the 
+		 *						   system entities are processed in parallel,
+		 *						   0 to process them serially.
+		 * @param tag_filter : Tag filter applied to the system view, like 
+		 *					   { ACS_None, ACS_None, ACS_Ignore } to skip 
+		 *					   ignored entities before OnProcess is called.
+		 *					   It's part of the system access so it can't 
+		 *					   change once the system is registered.
+		 **/
+		AcheronSystem( const uint32_t parallel_grain, const AcheronTagFilter& tag_filter )
+			: m_parallel_grain{ parallel_grain },
+			m_processed_count{ 0 },
+			m_tag_filter{ tag_filter }
+		{ };
 
 		/**
 		 * Destructor
@@ -67,30 +137,120 @@ namespace acs {
 
 		/**
 		 * Process override method
-		 * @note : Process the system component group.
+		 * @note : Process the system component group, entities are split 
+		 *		   across the context job system when a parallel grain is
+		 *		   set and filtered by the system tag filter.
 		 * @param context : Reference to current acheron context instance.
 		 * @param user_data : Pointer to external data that can be pass to
 		 *					  the process logic.
 		 **/
 		virtual void Process( AcheronContext& context, void* user_data ) override {
-			for ( auto components : AcheronComponentView<CompTypes...>( context, context ) )
-				OnProcess( context, user_data, components );
+			auto view  = AcheronComponentView<CompTypes...>( context, context ).WithTags( m_tag_filter );
+			auto batch = [ & ]( std::span<const AcheronUUID> entities, AcheronComponentSpan<CompTypes>... components ) -> void {
+				OnProcessBatch( context, user_data, entities, components... );
+			};
+
+			m_processed_count = view.GetCount( );
+
+			if ( m_parallel_grain > 0 )
+				view.ParallelEachBatch( batch, m_parallel_grain );
+			else
+				view.EachBatch( batch );
+		};
+
+		/**
+		 * Prepare override method
+		 * @note : Update the system view cache so concurrent systems only 
+		 *		   read it.
+		 * @param context : Reference to current acheron context instance.
+		 **/
+		virtual void Prepare( AcheronContext& context ) override {
+			auto& component_cache = context.GetComponentCache( );
+
+			component_cache.Get<CompTypes...>( context );
+		};
+
+		/**
+		 * GetAccess const override function
+		 * @note : Get the components accessed by the system, const component
+		 *		   types are read and other types are written. Override it to
+		 *		   make the system exclusive when OnProcess does structural 
+		 *		   changes. AcheronTag is read when a tag filter is set.
+		 * @return System component access.
+		 **/
+		virtual AcheronSystemAccess GetAccess( ) const override {
+			auto access = AcheronSystemAccess::Make<CompTypes...>( );
+
+			if ( !m_tag_filter.GetIsEmpty( ) )
+				access.Merge( AcheronSystemAccess::Make<const AcheronTag>( ) );
+
+			return access;
+		};
+
+		/**
+		 * GetProcessedCount const override function
+		 * @note : Get the view entry count of the last Process call.
+		 * @return Processed entity count as uint32_t.
+		 **/
+		virtual uint32_t GetProcessedCount( ) const override {
+			return m_processed_count;
 		};
 
 	protected:
+		/**
+		 * OnProcessBatch method
+		 * @note : Process a run of entities whose components are contiguous
+		 *		   in every storage, spans share the same size. Override it 
+		 *		   instead of OnProcess to write tight loops without a 
+		 *		   virtual call per entity, the default call OnProcess for
+		 *		   each entity. Spans are only valid until a structural change 
+		 *		   of one of the viewed storages, the default falls back to a
+		 *		   per entity lookup once OnProcess did one, overrides must 
+		 *		   not Append, Remove or Destroy viewed components.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to
+		 *					  the process logic.
+		 * @param entities : Run entity uuid's.
+		 * @param components : Run components, one span per component type,
+		 *					   ACS_Storage_Fields components are given as 
+		 *					   AcheronFieldSpan.
+		 **/
+		virtual void OnProcessBatch(
+			AcheronContext& context,
+			void* user_data,
+			std::span<const AcheronUUID> entities,
+			AcheronComponentSpan<CompTypes>... components
+		) {
+			const auto version = context.GetStructureVersion<CompTypes...>( );
+			auto index		   = size_t( 0 );
+
+			for ( ; index < entities.size( ) && context.GetStructureVersion<CompTypes...>( ) == version; index++ ) {
+				auto entity_components = std::tuple<AcheronUUID, AcheronComponentPointer<CompTypes>...>{ entities[ index ], GetComponentAt( components, index )... };
+
+				OnProcess( context, user_data, entity_components );
+			}
+
+			for ( ; index < entities.size( ); index++ ) {
+				auto entity_components = std::tuple<AcheronUUID, AcheronComponentPointer<CompTypes>...>{ entities[ index ], context.GetComponent<CompTypes>( entities[ index ] )... };
+
+				OnProcess( context, user_data, entity_components );
+			}
+		};
+
 		/**
 		 * OnProcess method
-		 * @note : Process a single entity and is component.
+		 * @note : Process a single entity and is component, unused when 
+		 *		   OnProcessBatch is overridden.
 		 * @param context : Reference to current acheron context instance.
 		 * @param user_data : Pointer to external data that can be pass to
 		 *					  the process logic.
 		 * @param components : Actual component view iterator tuple
 		 **/
 		virtual void OnProcess(
-			AcheronContext& context,
-			void* user_data,
-			std::tuple<AcheronUUID, CompTypes*...>& components
-		) = 0;
+			AcheronContext&,
+			void*,
+			std::tuple<AcheronUUID, AcheronComponentPointer<CompTypes>...>&
+		) { };
 
 	};
 
@@ -0,0 +1,111 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "_acheron_pch.h"
+
+namespace acs {
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	INTERNAL ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	static bool GetIsIntersecting( const std::vector<uint32_t>& a, const std::vector<uint32_t>& b ) {
+		auto iterator_a = a.begin( );
+		auto iterator_b = b.begin( );
+
+		while ( iterator_a != a.end( ) && iterator_b != b.end( ) ) {
+			if ( *iterator_a < *iterator_b )
+				++iterator_a;
+			else if ( *iterator_b < *iterator_a )
+				++iterator_b;
+			else
+				return true;
+		}
+
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	AcheronSystemAccess::AcheronSystemAccess( )
+		: AcheronSystemAccess{ false }
+	{
+	}
+
+	AcheronSystemAccess::AcheronSystemAccess( const bool is_exclusive )
+		: Reads{ },
+		Writes{ },
+		Storages{ },
+		IsExclusive{ is_exclusive }
+	{
+	}
+
+	void AcheronSystemAccess::Normalize( ) {
+		std::sort( Reads.begin( ), Reads.end( ) );
+		std::sort( Writes.begin( ), Writes.end( ) );
+
+		Reads.erase( std::unique( Reads.begin( ), Reads.end( ) ), Reads.end( ) );
+		Writes.erase( std::unique( Writes.begin( ), Writes.end( ) ), Writes.end( ) );
+
+		std::erase_if( Reads, [ & ]( const uint32_t index ) -> bool {
+			return std::binary_search( Writes.begin( ), Writes.end( ), index );
+		} );
+	}
+
+	void AcheronSystemAccess::Merge( const AcheronSystemAccess& other ) {
+		Reads.insert( Reads.end( ), other.Reads.begin( ), other.Reads.end( ) );
+		Writes.insert( Writes.end( ), other.Writes.begin( ), other.Writes.end( ) );
+		Storages.insert( Storages.end( ), other.Storages.begin( ), other.Storages.end( ) );
+
+		IsExclusive = IsExclusive || other.IsExclusive;
+
+		Normalize( );
+	}
+
+	void AcheronSystemAccess::CreateStorages( AcheronComponentManager& component_manager ) const {
+		for ( const auto factory : Storages )
+			factory( component_manager );
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC GET ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	bool AcheronSystemAccess::GetIsConflicting( const AcheronSystemAccess& other ) const {
+		if ( IsExclusive || other.IsExclusive )
+			return true;
+
+		return GetIsIntersecting( Writes, other.Writes )
+			|| GetIsIntersecting( Writes, other.Reads )
+			|| GetIsIntersecting( Reads, other.Writes );
+	}
+
+};
@@ -0,0 +1,129 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronSystemContext.h"
+
+namespace acs {
+
+	struct ACS_API AcheronSystemAccess {
+
+		using StorageFactory = void (*)( AcheronComponentManager& );
+
+		std::vector<uint32_t> Reads;
+		std::vector<uint32_t> Writes;
+		std::vector<StorageFactory> Storages;
+		bool IsExclusive;
+
+		/**
+		 * Constructor
+		 **/
+		AcheronSystemAccess( );
+
+		/**
+		 * Constructor
+		 * @param is_exclusive : True when the system must run alone, used 
+		 *                       by systems doing structural changes or 
+		 *                       undeclared component access.
+		 **/
+		AcheronSystemAccess( const bool is_exclusive );
+
+		/**
+		 * Make static template function
+		 * @note : Get access for a component list, const qualified types 
+		 *         are read and other types are written. Each storage 
+		 *         factory is kept so storages exist before systems run 
+		 *         concurrently.
+		 * @template CompTypes : System component types.
+		 * @return Component list access.
+		 **/
+		template<typename... CompTypes>
+		static AcheronSystemAccess Make( ) {
+			auto access = AcheronSystemAccess{ };
+
+			( [ & ]( ) -> void {
+				const auto index = GetComponentIndex<std::remove_cv_t<CompTypes>>( );
+
+				if constexpr ( std::is_const_v<CompTypes> )
+					access.Reads.emplace_back( index );
+				else
+					access.Writes.emplace_back( index );
+
+				access.Storages.emplace_back( []( AcheronComponentManager& component_manager ) -> void {
+					component_manager.GetStorage<CompTypes>( );
+				} );
+			}( ), ... );
+
+			access.Normalize( );
+
+			return access;
+		};
+
+		/**
+		 * Normalize method
+		 * @note : Sort and deduplicate component indices, written components
+		 *         are removed from read components.
+		 **/
+		void Normalize( );
+
+		/**
+		 * Merge method
+		 * @note : Add another access to this one, used by systems grouping
+		 *		   other systems.
+		 * @param other : Other system access.
+		 **/
+		void Merge( const AcheronSystemAccess& other );
+
+		/**
+		 * CreateStorages const method
+		 * @note : Create every declared component storage, called on the
+		 *		   scheduling thread as storages can't be created while 
+		 *		   systems run concurrently.
+		 * @param component_manager : Reference to current component 
+		 *							  manager instance.
+		 **/
+		void CreateStorages( AcheronComponentManager& component_manager ) const;
+
+		/**
+		 * GetIsConflicting const function
+		 * @note : Get if two accesses can't run concurrently, it's the case 
+		 *         when one is exclusive or when a component is written by 
+		 *         one and read or written by the other.
+		 * @param other : Other system access.
+		 * @return True when the accesses conflict.
+		 **/
+		bool GetIsConflicting( const AcheronSystemAccess& other ) const;
+
+	};
+
+};
@@ -40,7 +40,7 @@ namespace acs {
 	AcheronContext::AcheronContext( )
 		: m_entity_manager{ },
 		m_component_manager{ },
-		m_component_cache{ } 
+		m_component_cache{ }
 	{
 	}
 
@@ -50,10 +50,20 @@ namespace acs {
 	}
 
 	void AcheronContext::Clear( const bool reset_capacity ) {
+		AssertIsSerial( );
+
 		m_entity_manager.Clear( reset_capacity );
 		m_component_manager.Clear( reset_capacity );
 	}
 
+	void AcheronContext::SetJobSystem( AcheronJobSystem* job_system ) {
+		m_component_manager.SetJobSystem( job_system );
+	}
+
+	void AcheronContext::SetReusePolicy( const AcheronReusePolicies policy ) {
+		m_entity_manager.SetReusePolicy( policy );
+	}
+
 	AcheronUUID AcheronContext::Create( ) {
 		auto temp_component = AcheronTag{ };
 
@@ -79,6 +89,8 @@ namespace acs {
 	}
 
 	AcheronUUID AcheronContext::Create( AcheronTag&& tag_component ) {
+		AssertIsSerial( );
+
 		auto hierarchy = AcheronHierarchy{ };
 		auto entity    = m_entity_manager.Create( );
 		
@@ -89,10 +101,46 @@ namespace acs {
 		return entity;
 	}
 
+	void AcheronContext::Create( const uint32_t count, std::span<AcheronUUID> entities ) {
+		const auto tag_component = AcheronTag{ };
+
+		Create( count, entities, tag_component );
+	}
+
+	void AcheronContext::Create(
+		const uint32_t count,
+		std::span<AcheronUUID> entities,
+		const AcheronTag& tag_component
+	) {
+		ACS_ASSERT( entities.size( ) >= count, "Entity span must hold at least count uuids." );
+		AssertIsSerial( );
+
+		auto targets = entities.first( count );
+
+		m_entity_manager.Create( targets );
+
+		if ( !std::is_sorted( targets.begin( ), targets.end( ) ) )
+			std::sort( targets.begin( ), targets.end( ) );
+
+		auto uuids		 = std::vector<AcheronUUID>( targets.begin( ), targets.end( ) );
+		auto hierarchies = std::vector<AcheronHierarchy>( targets.size( ) );
+		auto tags		 = std::vector<AcheronTag>( targets.size( ), tag_component );
+
+		m_component_manager.GetStorage<AcheronUUID>( ).AppendRange( targets, uuids );
+		m_component_manager.GetStorage<AcheronHierarchy>( ).AppendRange( targets, hierarchies );
+		m_component_manager.GetStorage<AcheronTag>( ).AppendRange( targets, tags );
+	}
+
 	void AcheronContext::Destroy( const AcheronUUID entity, const bool use_sweep_destroy ) {
 		Destroy( entity, use_sweep_destroy, nullptr, { } );
 	}
 
+	void AcheronContext::Destroy( std::span<const AcheronUUID> entities, const bool use_sweep_destroy ) {
+		AssertIsSerial( );
+
+		m_entity_manager.Destroy( entities, use_sweep_destroy );
+	}
+
 	void AcheronContext::Destroy(
 		const AcheronUUID entity,
 		const bool use_sweep_destroy,
@@ -107,6 +155,8 @@ namespace acs {
 		void* user_data,
 		std::function<void( const AcheronUUID, void* )> callback
 	) {
+		AssertIsSerial( );
+
 		m_entity_manager.Destroy( entity, use_sweep_destroy );
 
 		if ( callback ) {
@@ -117,6 +167,10 @@ namespace acs {
 	}
 
 	void AcheronContext::Sweep( ) {
+		ACS_PROFILE_SCOPE( "AcheronContext::Sweep" );
+		ACS_PROFILE_COUNTER( "AcheronContext::SweepEntities", m_entity_manager.GetSweeEntities( ).size( ) );
+		AssertIsSerial( );
+
 		DestroyEntities( );
 		DestroyComponents( );
 	}
@@ -155,6 +209,10 @@ namespace acs {
 		return m_entity_manager.GetIsAlive( entity );
 	}
 
+	bool AcheronContext::GetIsSweepPending( ) const {
+		return !m_entity_manager.GetSweeEntities( ).empty( );
+	}
+
 	AcheronComponentManager& AcheronContext::GetComponentManager( ) {
 		return m_component_manager;
 	}
@@ -163,6 +221,10 @@ namespace acs {
 		return m_component_cache;
 	}
 
+	AcheronJobSystem* AcheronContext::GetJobSystem( ) const {
+		return m_component_manager.GetJobSystem( );
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////////////
 	//		===	OPERATOR ===
 	////////////////////////////////////////////////////////////////////////////////////////////
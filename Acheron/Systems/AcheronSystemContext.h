@@ -69,6 +69,22 @@ namespace acs {
 		 **/
 		void Clear( const bool reset_capacity );
 
+		/**
+		 * SetJobSystem method
+		 * @note : Set the job system used to parallelize context work, the
+		 *		   context don't own it.
+		 * @param job_system : Pointer to the job system, nullptr to run on
+		 *					   the calling thread.
+		 **/
+		void SetJobSystem( AcheronJobSystem* job_system );
+
+		/**
+		 * SetReusePolicy method
+		 * @note : Set the order destroyed entity indices are reused in.
+		 * @param policy : New reuse policy.
+		 **/
+		void SetReusePolicy( const AcheronReusePolicies policy );
+
 		/**
 		 * Create function
 		 * @note : Create an new entity.
@@ -108,6 +124,31 @@ namespace acs {
 		 **/
 		AcheronUUID Create( AcheronTag&& tag_component );
 
+		/**
+		 * Create method
+		 * @note : Create count entities, built-in components are appended 
+		 *		   with one sorted merge per storage.
+		 * @param count : Entity count to create.
+		 * @param entities : Span receiving the new entities uuids sorted 
+		 *					 ascending, must hold at least count uuids.
+		 **/
+		void Create( const uint32_t count, std::span<AcheronUUID> entities );
+
+		/**
+		 * Create method
+		 * @note : Create count entities, built-in components are appended 
+		 *		   with one sorted merge per storage.
+		 * @param count : Entity count to create.
+		 * @param entities : Span receiving the new entities uuids sorted 
+		 *					 ascending, must hold at least count uuids.
+		 * @param tag_component : Default entity tag component to copy.
+		 **/
+		void Create(
+			const uint32_t count,
+			std::span<AcheronUUID> entities,
+			const AcheronTag& tag_component
+		);
+
 		/**
 		 * Destroy method
 		 * @note : Destroy an entity using is uuid.
@@ -115,6 +156,14 @@ namespace acs {
 		 * @param use_sweep_destroy : True to use sweep destroy on the entity.
 		 **/
 		void Destroy( const AcheronUUID entity, const bool use_sweep_destroy );
+
+		/**
+		 * Destroy method
+		 * @note : Destroy a range of entities.
+		 * @param entities : Entities uuids to destroy.
+		 * @param use_sweep_destroy : True to use sweep destroy on the entities.
+		 **/
+		void Destroy( std::span<const AcheronUUID> entities, const bool use_sweep_destroy );
 		
 		/**
 		 * Destroy method
@@ -164,6 +213,15 @@ namespace acs {
 		 **/
 		void DestroyComponents( );
 
+		/**
+		 * AssertIsSerial const method
+		 * @note : Assert that no system run concurrently, structural 
+		 *		   changes are only allowed from exclusive systems.
+		 **/
+		void AssertIsSerial( ) const {
+			ACS_ASSERT( !m_component_manager.GetIsConcurrent( ), "Structural change from a system running concurrently, make the system exclusive in its access." );
+		};
+
 	public:
 		/**
 		 * Clear template method
@@ -175,6 +233,8 @@ namespace acs {
 		 **/
 		template<typename... CompTypes>
 		void Clear( const bool reset_capacity ) {
+			AssertIsSerial( );
+
 			m_component_manager.Clear<CompTypes...>( reset_capacity );
 		};
 
@@ -187,6 +247,8 @@ namespace acs {
 		 **/
 		template<typename CompType>
 		void Append( const AcheronUUID entity, const CompType& component ) {
+			AssertIsSerial( );
+
 			m_component_manager.Append<CompType>( entity, component );
 		};
 		
@@ -199,9 +261,40 @@ namespace acs {
          **/
 		template<typename CompType>
 		void Append( const AcheronUUID entity, CompType&& component ) {
+			AssertIsSerial( );
+
 			m_component_manager.Append<CompType>( entity, std::move( component ) );
 		};
 
+		/**
+		 * AppendRange template method
+		 * @note : Add a component to a range of entities with a single 
+		 *		   merge pass.
+		 * @template CompType : Component type to append.
+		 * @param entities : Entities uuids.
+		 * @param components : Component instances to move, one per entity.
+		 **/
+		template<typename CompType>
+		void AppendRange( std::span<const AcheronUUID> entities, std::span<CompType> components ) {
+			AssertIsSerial( );
+
+			m_component_manager.AppendRange<CompType>( entities, components );
+		};
+
+		/**
+		 * RemoveRange template method
+		 * @note : Remove a component from a range of entities with a single
+		 *		   filter pass.
+		 * @template CompType : Component type to remove.
+		 * @param entities : Entities uuids.
+		 **/
+		template<typename CompType>
+		void RemoveRange( std::span<const AcheronUUID> entities ) {
+			AssertIsSerial( );
+
+			m_component_manager.RemoveRange<CompType>( entities );
+		};
+
 		/**
 		 * Remove template method
 		 * @note : Remove a components from an entity.
@@ -210,6 +303,8 @@ namespace acs {
 		 **/
 		template<typename... CompTypes>
 		void Remove( const AcheronUUID entity ) {
+			AssertIsSerial( );
+
 			m_component_manager.Remove<CompTypes...>( entity );
 		};
 
@@ -236,6 +331,14 @@ namespace acs {
 		 **/
 		bool GetIsAlive( const AcheronUUID entity ) const;
 
+		/**
+		 * GetIsSweepPending const function
+		 * @note : Check if entities destroyed with sweep destroy are waiting
+		 *		   for Sweep.
+		 * @return True when Sweep has work to do.
+		 **/
+		bool GetIsSweepPending( ) const;
+
 		/**
 		 * GetComponentManager function
 		 * @note : Get curent component manager instance.
@@ -250,6 +353,14 @@ namespace acs {
 		 **/
 		AcheronComponentCache& GetComponentCache( );
 
+		/**
+		 * GetJobSystem const function
+		 * @note : Get current job system.
+		 * @return Pointer to current job system, nullptr when the context
+		 *		   work run on the calling thread.
+		 **/
+		AcheronJobSystem* GetJobSystem( ) const;
+
 	public:
 		/**
          * GetStorage template function
@@ -258,10 +369,21 @@ namespace acs {
          * @return Reference to component storage.
          **/
 		template<typename CompType>
-		auto GetStorage( ) const -> AcheronComponentStorage<CompType>& {
+		auto GetStorage( ) const -> AcheronComponentStorageOf<CompType>& {
 			return m_component_manager.GetStorage<CompType>( );
 		};
 
+		/**
+		 * GetStructureVersion template function
+		 * @note : Get the summed structural version of component storages.
+		 * @template CompTypes : Storage component types.
+		 * @return Summed component storage version as uint64_t.
+		 **/
+		template<typename... CompTypes>
+		uint64_t GetStructureVersion( ) const {
+			return m_component_manager.GetStructureVersion<CompTypes...>( );
+		};
+
 		/**
 		 * GetComponentVector template function
 		 * @note : Get all component stored inside the storage.
@@ -278,10 +400,11 @@ namespace acs {
 		 * @note : Get component for a specific entity.
 		 * @template CompType : Storage component type.
 		 * @param entity : Target entity uuid.
-		 * @return Pointer the component or nullptr if not found.
+		 * @return Pointer the component or nullptr if not found, a field 
+		 *		   reference for ACS_Storage_Fields components.
 		 **/
 		template<typename CompType>
-		auto GetComponent( const AcheronUUID entity ) -> CompType* {
+		auto GetComponent( const AcheronUUID entity ) -> AcheronComponentPointer<CompType> {
 			return m_component_manager.GetComponent<CompType>( entity );
 		};
 
@@ -290,10 +413,11 @@ namespace acs {
 		 * @note : Get component for a specific entity.
 		 * @template CompType : Storage component type.
 		 * @param entity : Target entity uuid.
-		 * @return Constant pointer the component or nullptr if not found.
+		 * @return Constant pointer the component or nullptr if not found, a
+		 *		   field reference for ACS_Storage_Fields components.
 		 **/
 		template<typename CompType>
-		auto GetComponent( const AcheronUUID entity ) const -> const CompType* {
+		auto GetComponent( const AcheronUUID entity ) const -> AcheronComponentPointer<const CompType> {
 			return m_component_manager.GetComponent<CompType>( entity );
 		};
 
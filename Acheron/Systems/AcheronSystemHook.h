@@ -32,7 +32,7 @@
 
 #pragma once
 
-#include "AcheronSystem.h"
+#include "AcheronPipeline.h"
 
 namespace acs {
 
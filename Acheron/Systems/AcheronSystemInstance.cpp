@@ -40,7 +40,14 @@ namespace acs {
 	AcheronSystemInstance::AcheronSystemInstance( )
 		: Instance{ nullptr },
 		Hooks{ },
+		Access{ },
+		Tick{ },
+		Stage{ ACS_Stage_Update },
+		Order{ 0 },
 		IsActive{ true }
+#   ifdef ACS_ENABLE_PROFILING
+		, Profile{ }
+#   endif
 	{
 	}
 
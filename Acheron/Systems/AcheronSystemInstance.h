@@ -32,15 +32,32 @@
 
 #pragma once
 
-#include "AcheronSystemHook.h"
+#include "AcheronSystemProfile.h"
 
 namespace acs {
 
+	enum AcheronSystemStages : uint32_t {
+
+		ACS_Stage_PreUpdate = 0,
+		ACS_Stage_Update,
+		ACS_Stage_PostUpdate,
+
+		ACS_Stage_Count
+
+	};
+
 	struct ACS_API AcheronSystemInstance {
 
 		std::unique_ptr<IAcheronSystem> Instance;
 		AcheronSystemHook Hooks;
+		AcheronSystemAccess Access;
+		AcheronSystemTick Tick;
+		AcheronSystemStages Stage;
+		uint32_t Order;
 		bool IsActive;
+#   ifdef ACS_ENABLE_PROFILING
+		AcheronSystemProfile Profile;
+#   endif
 
 		/**
 		 * Constructor
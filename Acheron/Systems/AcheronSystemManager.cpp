@@ -39,7 +39,17 @@ namespace acs {
 	////////////////////////////////////////////////////////////////////////////////////////////
 	AcheronSystemManager::AcheronSystemManager( )
 		: m_uuids{ },
-		m_systems{ } 
+		m_systems{ },
+		m_orders{ },
+		m_batches{ },
+		m_stage_ends{ },
+		m_run_counts{ },
+		m_last_tick{ std::chrono::steady_clock::now( ) },
+		m_is_schedule_dirty{ true },
+		m_is_storage_dirty{ true }
+#   ifdef ACS_ENABLE_PROFILING
+		, m_trace{ }
+#   endif
 	{
 	}
 
@@ -51,8 +61,52 @@ namespace acs {
 	}
 
 	void AcheronSystemManager::Process( AcheronContext& context, void* user_data ) {
-		for ( auto& instance : m_systems )
-			Process( instance, context, user_data );
+		const auto now		  = std::chrono::steady_clock::now( );
+		const auto delta_time = std::chrono::duration<float>( now - m_last_tick ).count( );
+
+		m_last_tick = now;
+
+		Process( context, user_data, delta_time );
+	}
+
+	void AcheronSystemManager::Process( AcheronContext& context, void* user_data, const float delta_time ) {
+		ACS_PROFILE_SCOPE( "AcheronSystemManager::Process" );
+
+		if ( m_is_schedule_dirty )
+			BuildSchedule( );
+
+		if ( m_is_storage_dirty )
+			CreateStorages( context );
+
+		for ( const auto& batch : m_batches ) {
+			for ( const auto index : batch )
+				m_run_counts[ index ] = m_systems[ index ].Tick.Advance( delta_time );
+		}
+
+		auto batch_id = uint32_t( 0 );
+
+		for ( const auto stage_end : m_stage_ends ) {
+			for ( ; batch_id < stage_end; batch_id++ )
+				ProcessBatch( m_batches[ batch_id ], context, user_data );
+
+			if ( context.GetIsSweepPending( ) )
+				context.Sweep( );
+		}
+	}
+
+	void AcheronSystemManager::StartTrace( ) {
+#   ifdef ACS_ENABLE_PROFILING
+		m_trace.Start( );
+#   endif
+	}
+
+	void AcheronSystemManager::StopTrace( std::ostream& stream ) {
+#   ifdef ACS_ENABLE_PROFILING
+		m_trace.Stop( );
+		m_trace.Write( stream );
+#   else
+		(void)stream;
+#   endif
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,14 +117,248 @@ namespace acs {
 		AcheronContext& context,
 		void* user_data
 	) {
+#   ifdef ACS_ENABLE_PROFILING
+		using Milliseconds = std::chrono::duration<float, std::milli>;
+
+		ACS_PROFILE_SCOPE( instance.Profile.Name );
+
+		const auto pre_start = std::chrono::steady_clock::now( );
+
 		instance.Hooks.PreProcess( context, user_data );
+
+		const auto start = std::chrono::steady_clock::now( );
+
 		instance.Instance->Process( context, user_data );
+
+		const auto stop = std::chrono::steady_clock::now( );
+
 		instance.Hooks.PostProcess( context, user_data );
+
+		const auto post_stop	= std::chrono::steady_clock::now( );
+		const auto entity_count = instance.Instance->GetProcessedCount( );
+		const auto hook_time	= Milliseconds( ( start - pre_start ) + ( post_stop - stop ) ).count( );
+
+		instance.Profile.Record( Milliseconds( stop - start ).count( ), hook_time, entity_count );
+
+		m_trace.Record( instance.Profile.Name, pre_start, post_stop, entity_count );
+#   else
+		instance.Hooks.PreProcess( context, user_data );
+		instance.Instance->Process( context, user_data );
+		instance.Hooks.PostProcess( context, user_data );
+#   endif
+	}
+
+	void AcheronSystemManager::ProcessTicks(
+		const uint32_t index,
+		AcheronContext& context,
+		void* user_data
+	) {
+		auto& instance		 = m_systems[ index ];
+		const auto run_count = m_run_counts[ index ];
+
+		if ( run_count == 0 )
+			return;
+
+		if ( instance.Tick.Policy != ACS_Tick_Budget ) {
+			for ( auto run = uint32_t( 0 ); run < run_count; run++ )
+				Process( instance, context, user_data );
+
+			return;
+		}
+
+		const auto start = std::chrono::steady_clock::now( );
+
+		for ( auto run = uint32_t( 0 ); run < run_count; run++ )
+			Process( instance, context, user_data );
+
+		const auto stop = std::chrono::steady_clock::now( );
+
+		instance.Tick.Consume( std::chrono::duration<float>( stop - start ).count( ) );
+	}
+
+	void AcheronSystemManager::ProcessBatch(
+		const std::vector<uint32_t>& batch,
+		AcheronContext& context,
+		void* user_data
+	) {
+		auto* job_system = context.GetJobSystem( );
+		const auto due_count = std::count_if( batch.begin( ), batch.end( ), [ & ]( const uint32_t index ) -> bool {
+			return m_run_counts[ index ] > 0;
+		} );
+
+		if ( due_count == 0 )
+			return;
+
+		if ( due_count == 1 || !job_system || job_system->GetWorkerCount( ) == 0 ) {
+			for ( const auto index : batch )
+				ProcessTicks( index, context, user_data );
+
+			return;
+		}
+
+		auto& component_manager = context.GetComponentManager( );
+		auto counter			= AcheronJobCounter{ };
+
+		for ( const auto index : batch ) {
+			if ( m_run_counts[ index ] > 0 )
+				m_systems[ index ].Instance->Prepare( context );
+		}
+
+		component_manager.SetIsConcurrent( true );
+
+		for ( const auto index : batch ) {
+			if ( m_run_counts[ index ] == 0 )
+				continue;
+
+			job_system->Schedule( [ this, index, &context, user_data ]( ) {
+				ProcessTicks( index, context, user_data );
+			}, &counter );
+		}
+
+		job_system->WaitFor( counter );
+
+		component_manager.SetIsConcurrent( false );
+	}
+
+	void AcheronSystemManager::BuildSchedule( ) {
+		ACS_PROFILE_SCOPE( "AcheronSystemManager::BuildSchedule" );
+
+		auto predecessors = std::vector<std::vector<uint32_t>>( m_systems.size( ) );
+		auto batch_ids	  = std::vector<uint32_t>( m_systems.size( ), 0 );
+
+		m_batches.clear( );
+		m_run_counts.assign( m_systems.size( ), 0 );
+
+		for ( auto stage = uint32_t( 0 ); stage < ACS_Stage_Count; stage++ ) {
+			const auto stage_start = uint32_t( m_batches.size( ) );
+			const auto order	   = SortStage( AcheronSystemStages( stage ), predecessors );
+
+			for ( const auto index : order ) {
+				const auto& access = m_systems[ index ].Access;
+				auto first_batch   = stage_start;
+				auto batch_id	   = uint32_t( m_batches.size( ) );
+
+				for ( const auto predecessor : predecessors[ index ] )
+					first_batch = std::max( first_batch, batch_ids[ predecessor ] + 1 );
+
+				while ( batch_id > first_batch ) {
+					const auto& batch = m_batches[ batch_id - 1 ];
+					const auto is_conflicting = std::any_of( batch.begin( ), batch.end( ), [ & ]( const uint32_t other ) -> bool {
+						return access.GetIsConflicting( m_systems[ other ].Access );
+					} );
+
+					if ( is_conflicting )
+						break;
+
+					batch_id -= 1;
+				}
+
+				if ( batch_id == m_batches.size( ) )
+					m_batches.emplace_back( );
+
+				m_batches[ batch_id ].emplace_back( index );
+
+				batch_ids[ index ] = batch_id;
+			}
+
+			m_stage_ends[ stage ] = uint32_t( m_batches.size( ) );
+		}
+
+		m_is_schedule_dirty = false;
+	}
+
+	void AcheronSystemManager::CreateStorages( AcheronContext& context ) {
+		auto& component_manager = context.GetComponentManager( );
+
+		for ( const auto& instance : m_systems )
+			instance.Access.CreateStorages( component_manager );
+
+		m_is_storage_dirty = false;
+	}
+
+	std::vector<uint32_t> AcheronSystemManager::SortStage(
+		const AcheronSystemStages stage,
+		std::vector<std::vector<uint32_t>>& predecessors
+	) const {
+		auto successors = std::vector<std::vector<uint32_t>>( m_systems.size( ) );
+		auto in_degrees = std::vector<uint32_t>( m_systems.size( ), 0 );
+		auto ready		= std::vector<uint32_t>{ };
+		auto order		= std::vector<uint32_t>{ };
+		auto iterator	= std::vector<AcheronUUID>::const_iterator( );
+		auto stage_size = size_t( 0 );
+
+		for ( const auto& system_order : m_orders ) {
+			auto first  = size_t( 0 );
+			auto second = size_t( 0 );
+
+			if ( !FindIndex( system_order.First, iterator, first ) || !FindIndex( system_order.Second, iterator, second ) )
+				continue;
+
+			if ( !GetIsScheduled( first, stage ) || !GetIsScheduled( second, stage ) || first == second )
+				continue;
+
+			predecessors[ second ].emplace_back( uint32_t( first ) );
+			successors[ first ].emplace_back( uint32_t( second ) );
+			in_degrees[ second ] += 1;
+		}
+
+		for ( auto index = uint32_t( 0 ); index < m_systems.size( ); index++ ) {
+			if ( !GetIsScheduled( index, stage ) )
+				continue;
+
+			stage_size += 1;
+
+			if ( in_degrees[ index ] == 0 )
+				ready.emplace_back( index );
+		}
+
+		order.reserve( stage_size );
+
+		while ( !ready.empty( ) ) {
+			const auto next = std::min_element( ready.begin( ), ready.end( ), [ & ]( const uint32_t a, const uint32_t b ) -> bool {
+				return m_systems[ a ].Order < m_systems[ b ].Order;
+			} );
+			const auto index = *next;
+
+			ready.erase( next );
+			order.emplace_back( index );
+
+			for ( const auto successor : successors[ index ] ) {
+				if ( --in_degrees[ successor ] == 0 )
+					ready.emplace_back( successor );
+			}
+		}
+
+		ACS_ASSERT( order.size( ) == stage_size, "System order constraints contain a cycle." );
+
+		// Systems caught in a cycle still run, in registration order.
+		for ( auto index = uint32_t( 0 ); order.size( ) < stage_size; index++ ) {
+			if ( GetIsScheduled( index, stage ) && in_degrees[ index ] > 0 )
+				order.emplace_back( index );
+		}
+
+		return order;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC GET ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	uint32_t AcheronSystemManager::GetBatchCount( ) {
+		if ( m_is_schedule_dirty )
+			BuildSchedule( );
+
+		return uint32_t( m_batches.size( ) );
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////////////
 	//		===	PRIVATE GET ===
 	////////////////////////////////////////////////////////////////////////////////////////////
+	bool AcheronSystemManager::GetIsScheduled( const size_t index, const AcheronSystemStages stage ) const {
+		const auto& instance = m_systems[ index ];
+
+		return instance.IsActive && instance.Stage == stage;
+	}
+
 	bool AcheronSystemManager::FindIndex(
 		const AcheronUUID uuid,
 		std::vector<AcheronUUID>::const_iterator& iterator,
@@ -80,14 +368,9 @@ namespace acs {
 		const auto iterator_stop  = m_uuids.end( );
 
 		iterator = std::lower_bound( iterator_start, iterator_stop, uuid );
+		index	 = std::distance( iterator_start, iterator );
 
-		if ( iterator != iterator_stop && *iterator != uuid ) {
-			index = std::distance( iterator_start, iterator );
-
-			return true;
-		}
-
-		return false;
+		return iterator != iterator_stop && *iterator == uuid;
 	}
 
 };
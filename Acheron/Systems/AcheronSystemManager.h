@@ -37,13 +37,30 @@
 namespace acs {
 
 	template<typename... SysTypes>
-	concept IsSystem = ( std::is_base_of_v<IAcheronSystem, SysTypes>, ... );
+	concept IsSystem = ( std::is_base_of_v<IAcheronSystem, SysTypes> && ... );
 
 	class ACS_API AcheronSystemManager final {
 
+		struct SystemOrder {
+
+			AcheronUUID First;
+			AcheronUUID Second;
+
+		};
+
 	private:
 		std::vector<AcheronUUID> m_uuids;
 		std::vector<AcheronSystemInstance> m_systems;
+		std::vector<SystemOrder> m_orders;
+		std::vector<std::vector<uint32_t>> m_batches;
+		std::array<uint32_t, ACS_Stage_Count> m_stage_ends;
+		std::vector<uint32_t> m_run_counts;
+		std::chrono::steady_clock::time_point m_last_tick;
+		bool m_is_schedule_dirty;
+		bool m_is_storage_dirty;
+#   ifdef ACS_ENABLE_PROFILING
+		AcheronTrace m_trace;
+#   endif
 
 	public:
 		/**
@@ -65,13 +82,47 @@ namespace acs {
 
 		/**
 		 * Process method
-		 * @note : Process all activated system.
+		 * @note : Process all activated system stage by stage, systems of
+		 *		   a stage are grouped in batches of non conflicting 
+		 *		   component access processed concurrently on the context 
+		 *		   job system. Deferred entity destructions are swept at the
+		 *		   end of each stage. Elapsed time for tick policies is 
+		 *		   measured since the previous call.
 		 * @param context : Reference to current acheron context instance.
 		 * @param user_data : Pointer to external data that can be pass to 
 		 *					  the process logic.
 		 **/
 		void Process( AcheronContext& context, void* user_data );
 
+		/**
+		 * Process method
+		 * @note : Process all activated system with an explicit elapsed 
+		 *		   time for tick policies.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to 
+		 *					  the process logic.
+		 * @param delta_time : Elapsed time since previous tick in seconds.
+		 **/
+		void Process( AcheronContext& context, void* user_data, const float delta_time );
+
+		/**
+		 * StartTrace method
+		 * @note : Start recording a trace event per system run, previous 
+		 *		   events are dropped. Does nothing unless ACS_ENABLE_PROFILING
+		 *		   is defined.
+		 **/
+		void StartTrace( );
+
+		/**
+		 * StopTrace method
+		 * @note : Stop recording system runs and write recorded events as 
+		 *		   Chrome trace event JSON, loadable in chrome://tracing or 
+		 *		   Perfetto. Does nothing unless ACS_ENABLE_PROFILING is 
+		 *		   defined.
+		 * @param stream : Reference to the output stream.
+		 **/
+		void StopTrace( std::ostream& stream );
+
 	public:
 		/**
 		 * Register template function
@@ -88,20 +139,105 @@ namespace acs {
 			auto instance = AcheronSystemInstance{ };
 			auto iterator = std::vector<AcheronUUID>::const_iterator( );
 			auto index	  = size_t( 0 );
-			auto uuid	  = AcheronUUID::Make<SysType>( );
+			constexpr auto uuid = AcheronUUID::Make<SysType>( );
 			
 			ACS_ASSERT( !FindIndex( uuid, iterator, index ), "This system type is already instantiate." );
 
-			instance.Instance = std::make_unique<SysType>( std::forward<ArgTypes>( args )... );
+			auto system = std::make_unique<SysType>( std::forward<ArgTypes>( args )... );
+			auto* system_instance = system.get( );
 
 			ACS_ASSERT( system != nullptr, "System creation failed." );
 
+			instance.Access   = system->GetAccess( );
+			instance.Instance = std::move( system );
+			instance.Order	  = uint32_t( m_systems.size( ) );
+			instance.IsActive = immediate_start;
+
+#   ifdef ACS_ENABLE_PROFILING
+			instance.Profile.Name = GetTypeName<SysType>( );
+#   endif
+
 			const auto systems_start = m_systems.begin( );
 
-			m_uuids.insert( iterator, std::move( uuid ) );
+			m_uuids.insert( iterator, uuid );
 			m_systems.insert( systems_start + index, std::move( instance ) );
 
-			return instance.Instance.get( );
+			m_is_schedule_dirty = true;
+			m_is_storage_dirty	= true;
+
+			return system_instance;
+		};
+
+		/**
+		 * SetStage method
+		 * @note : Set the stage of a collection of system, systems are
+		 *		   registered in ACS_Stage_Update.
+		 * @template SysTypes : Collection of system type.
+		 * @param stage : Target stage.
+		 **/
+		template<typename... SysTypes>
+			requires IsSystem<SysTypes...>
+		void SetStage( const AcheronSystemStages stage ) {
+			ACS_ASSERT( stage < ACS_Stage_Count, "Invalid system stage." );
+
+			( [ & ]( ) -> void {
+				if ( auto* instance = Get<SysTypes>( ) )
+					instance->Stage = stage;
+			}( ), ... );
+
+			m_is_schedule_dirty = true;
+		};
+
+		/**
+		 * SetTickPolicy method
+		 * @note : Set how often a collection of system run, systems are 
+		 *		   registered with a policy running them every tick.
+		 * @template SysTypes : Collection of system type.
+		 * @param tick : Tick policy, each system get its own copy.
+		 **/
+		template<typename... SysTypes>
+			requires IsSystem<SysTypes...>
+		void SetTickPolicy( const AcheronSystemTick& tick ) {
+			( [ & ]( ) -> void {
+				if ( auto* instance = Get<SysTypes>( ) )
+					instance->Tick = tick;
+			}( ), ... );
+		};
+
+		/**
+		 * RunBefore method
+		 * @note : Make a system run before a collection of system of the
+		 *		   same stage, systems don't need to be registered yet. 
+		 *		   Constraints between different stages are ignored, stage
+		 *		   order prevails, constraints through a disabled system too.
+		 * @template SysType : System type.
+		 * @template OtherTypes : Collection of system running after SysType.
+		 **/
+		template<typename SysType, typename... OtherTypes>
+			requires IsSystem<SysType, OtherTypes...>
+		void RunBefore( ) {
+			constexpr auto uuid = AcheronUUID::Make<SysType>( );
+
+			( m_orders.emplace_back( SystemOrder{ uuid, AcheronUUID::Make<OtherTypes>( ) } ), ... );
+
+			m_is_schedule_dirty = true;
+		};
+
+		/**
+		 * RunAfter method
+		 * @note : Make a system run after a collection of system of the 
+		 *		   same stage, see RunBefore.
+		 * @template SysType : System type.
+		 * @template OtherTypes : Collection of system running before SysType.
+		 **/
+		template<typename SysType, typename... OtherTypes>
+			requires IsSystem<SysType, OtherTypes...>
+		void RunAfter( ) {
+			constexpr auto uuid = AcheronUUID::Make<SysType>( );
+
+			( m_orders.emplace_back( SystemOrder{ AcheronUUID::Make<OtherTypes>( ), uuid } ), ... );
+
+			m_is_schedule_dirty = true;
 		};
 
 		/**
@@ -121,6 +257,8 @@ namespace acs {
 					instance->Hooks.Enable( context, user_data );
 				}
 			}( ), ... );
+
+			m_is_schedule_dirty = true;
 		};
 
 		/**
@@ -140,6 +278,8 @@ namespace acs {
 					instance->Hooks.Disable( context, user_data );
 				}
 			}( ), ... );
+
+			m_is_schedule_dirty = true;
 		};
 
 		/**
@@ -174,6 +314,69 @@ namespace acs {
 			void* user_data
 		);
 
+		/**
+		 * ProcessTicks method
+		 * @note : Run a scheduled system as many times as its tick policy
+		 *		   requested for the current tick.
+		 * @param index : System index.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to 
+		 *					  the process logic.
+		 **/
+		void ProcessTicks(
+			const uint32_t index,
+			AcheronContext& context,
+			void* user_data
+		);
+
+		/**
+		 * ProcessBatch method
+		 * @note : Process a batch of non conflicting systems, concurrently
+		 *		   when the job system has workers, systems without runs due
+		 *		   this tick are skipped.
+		 * @param batch : Reference to the batch system indices.
+		 * @param context : Reference to current acheron context instance.
+		 * @param user_data : Pointer to external data that can be pass to 
+		 *					  the process logic.
+		 **/
+		void ProcessBatch(
+			const std::vector<uint32_t>& batch,
+			AcheronContext& context,
+			void* user_data
+		);
+
+		/**
+		 * BuildSchedule method
+		 * @note : Sort each stage active systems so order constraints are
+		 *		   met, ties keep registration order, then group them in 
+		 *		   batches. Disabled systems cost nothing per tick. Each
+		 *		   system is placed after the last batch holding a conflicting
+		 *		   system or a system it must run after.
+		 **/
+		void BuildSchedule( );
+
+		/**
+		 * CreateStorages method
+		 * @note : Create every storage declared by registered systems, so
+		 *		   concurrent systems never create one.
+		 * @param context : Reference to current acheron context instance.
+		 **/
+		void CreateStorages( AcheronContext& context );
+
+		/**
+		 * SortStage method
+		 * @note : Topologically sort a stage active systems from order 
+		 *		   constraints.
+		 * @param stage : Stage to sort.
+		 * @param predecessors : Reference to per system indices of systems
+		 *						 it must run after, filled for the stage.
+		 * @return Stage system indices in processing order.
+		 **/
+		std::vector<uint32_t> SortStage(
+			const AcheronSystemStages stage,
+			std::vector<std::vector<uint32_t>>& predecessors
+		) const;
+
 	public:
 		/**
 		 * GetIsActive const function
@@ -204,6 +407,36 @@ namespace acs {
 			return ( GetIsActive<SysTypes>( ) && ... );
 		};
 
+		/**
+		 * GetBatchCount function
+		 * @note : Get the count of sequential system batches, systems in 
+		 *		   a batch run concurrently.
+		 * @return System batch count as uint32_t.
+		 **/
+		uint32_t GetBatchCount( );
+
+		/**
+		 * GetProfile const template function
+		 * @note : Get a system profile, wall times in milliseconds and 
+		 *		   entity counts of its last runs.
+		 * @template SysType : System type.
+		 * @return Constant pointer to the system profile, nullptr when the
+		 *		   system isn't registered or ACS_ENABLE_PROFILING isn't 
+		 *		   defined.
+		 **/
+		template<typename SysType>
+			requires IsSystem<SysType>
+		const AcheronSystemProfile* GetProfile( ) const {
+			auto* profile = (const AcheronSystemProfile*)nullptr;
+
+#   ifdef ACS_ENABLE_PROFILING
+			if ( auto* instance = Get<SysType>( ) )
+				profile = &instance->Profile;
+#   endif
+
+			return profile;
+		};
+
 		/**
 		 * Get template function
 		 * @note : Get system instance. 
@@ -216,7 +449,7 @@ namespace acs {
 			auto* instance = (AcheronSystemInstance*)nullptr;
 			auto iterator  = std::vector<AcheronUUID>::const_iterator( );
 			auto index	   = size_t( 0 );
-			auto uuid	   = AcheronUUID::Make<SysType>( );
+			constexpr auto uuid = AcheronUUID::Make<SysType>( );
 
 			if ( FindIndex( uuid, iterator, index ) )
 				instance = &m_systems[ index ];
@@ -233,10 +466,10 @@ namespace acs {
 		template<typename SysType>
 			requires IsSystem<SysType>
 		const AcheronSystemInstance* Get( ) const {
-			auto* instance = (AcheronSystemInstance*)nullptr;
+			auto* instance = (const AcheronSystemInstance*)nullptr;
 			auto iterator  = std::vector<AcheronUUID>::const_iterator( );
 			auto index	   = size_t( 0 );
-			auto uuid	   = AcheronUUID::Make<SysType>( );
+			constexpr auto uuid = AcheronUUID::Make<SysType>( );
 
 			if ( FindIndex( uuid, iterator, index ) )
 				instance = &m_systems[ index ];
@@ -245,6 +478,15 @@ namespace acs {
 		};
 
 	private:
+		/**
+		 * GetIsScheduled const function
+		 * @note : Get if a system is active and part of a stage.
+		 * @param index : System index.
+		 * @param stage : Stage to check.
+		 * @return True when the system must be scheduled in the stage.
+		 **/
+		bool GetIsScheduled( const size_t index, const AcheronSystemStages stage ) const;
+
 		/**
 		 * FindIndex const function
 		 * @note : Find system index from system uuid.
@@ -0,0 +1,196 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "_acheron_pch.h"
+
+namespace acs {
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	INTERNAL ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	static void WriteJsonString( std::ostream& stream, const std::string_view text ) {
+		stream << '"';
+
+		for ( const auto character : text ) {
+			if ( character == '"' || character == '\\' )
+				stream << '\\';
+
+			stream << character;
+		}
+
+		stream << '"';
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	AcheronSampleWindow::AcheronSampleWindow( )
+		: m_samples{ },
+		m_cursor{ 0 },
+		m_count{ 0 }
+	{
+	}
+
+	void AcheronSampleWindow::Push( const float sample ) {
+		m_samples[ m_cursor ] = sample;
+		m_cursor			  = ( m_cursor + 1 ) % WindowSize;
+		m_count				  = std::min( m_count + 1, WindowSize );
+	}
+
+	void AcheronSampleWindow::Clear( ) {
+		m_cursor = 0;
+		m_count	 = 0;
+	}
+
+	AcheronSystemProfile::AcheronSystemProfile( )
+		: Name{ },
+		ProcessTimes{ },
+		HookTimes{ },
+		EntityCounts{ }
+	{
+	}
+
+	void AcheronSystemProfile::Record( 
+		const float process_time,
+		const float hook_time,
+		const uint32_t entity_count
+	) {
+		ProcessTimes.Push( process_time );
+		HookTimes.Push( hook_time );
+		EntityCounts.Push( float( entity_count ) );
+	}
+
+	AcheronTrace::AcheronTrace( )
+		: m_mutex{ },
+		m_events{ },
+		m_start{ std::chrono::steady_clock::now( ) },
+		m_is_recording{ false }
+	{
+	}
+
+	void AcheronTrace::Start( ) {
+		auto lock = std::unique_lock{ m_mutex };
+
+		m_events.clear( );
+
+		m_start = std::chrono::steady_clock::now( );
+
+		m_is_recording.store( true, std::memory_order_release );
+	}
+
+	void AcheronTrace::Stop( ) {
+		m_is_recording.store( false, std::memory_order_release );
+	}
+
+	void AcheronTrace::Record(
+		const std::string_view name,
+		const std::chrono::steady_clock::time_point start,
+		const std::chrono::steady_clock::time_point stop,
+		const uint32_t entity_count
+	) {
+		if ( !GetIsRecording( ) )
+			return;
+
+		const auto thread = uint64_t( std::hash<std::thread::id>{ }( std::this_thread::get_id( ) ) );
+		auto lock = std::unique_lock{ m_mutex };
+		const auto event_start	  = std::chrono::duration_cast<std::chrono::microseconds>( start - m_start ).count( );
+		const auto event_duration = std::chrono::duration_cast<std::chrono::microseconds>( stop - start ).count( );
+
+		m_events.emplace_back( TraceEvent{ name, thread, event_start, event_duration, entity_count } );
+	}
+
+	void AcheronTrace::Write( std::ostream& stream ) {
+		auto lock = std::unique_lock{ m_mutex };
+		auto is_first = true;
+
+		stream << "{\"traceEvents\":[";
+
+		for ( const auto& event : m_events ) {
+			if ( !is_first )
+				stream << ',';
+
+			stream << "{\"name\":";
+			WriteJsonString( stream, event.Name );
+			stream << ",\"cat\":\"system\",\"ph\":\"X\",\"pid\":0"
+				<< ",\"tid\":" << event.Thread
+				<< ",\"ts\":" << event.Start
+				<< ",\"dur\":" << event.Duration
+				<< ",\"args\":{\"entities\":" << event.EntityCount << "}}";
+
+			is_first = false;
+		}
+
+		stream << "],\"displayTimeUnit\":\"ms\"}";
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC GET ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	uint32_t AcheronSampleWindow::GetCount( ) const {
+		return m_count;
+	}
+
+	float AcheronSampleWindow::GetLast( ) const {
+		if ( m_count == 0 )
+			return 0.f;
+
+		return m_samples[ ( m_cursor + WindowSize - 1 ) % WindowSize ];
+	}
+
+	AcheronProfileStats AcheronSampleWindow::GetStats( ) const {
+		auto stats = AcheronProfileStats{ 0.f, 0.f, 0.f, 0.f };
+
+		if ( m_count == 0 )
+			return stats;
+
+		auto samples = std::vector<float>( m_samples.begin( ), m_samples.begin( ) + m_count );
+		auto percentile = [ & ]( const float rank ) -> float {
+			const auto index = std::min( size_t( rank * float( samples.size( ) ) ), samples.size( ) - 1 );
+
+			std::nth_element( samples.begin( ), samples.begin( ) + index, samples.end( ) );
+
+			return samples[ index ];
+		};
+
+		stats.P50 = percentile( 0.50f );
+		stats.P95 = percentile( 0.95f );
+		stats.P99 = percentile( 0.99f );
+		stats.Max = *std::max_element( samples.begin( ), samples.end( ) );
+
+		return stats;
+	}
+
+	bool AcheronTrace::GetIsRecording( ) const {
+		return m_is_recording.load( std::memory_order_acquire );
+	}
+
+};
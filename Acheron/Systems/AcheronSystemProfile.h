@@ -0,0 +1,194 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronSystemTick.h"
+
+namespace acs {
+
+	struct ACS_API AcheronProfileStats {
+
+		float P50;
+		float P95;
+		float P99;
+		float Max;
+
+	};
+
+	class ACS_API AcheronSampleWindow final {
+
+	public:
+		// Sample count kept by the window, older samples are overwritten.
+		static constexpr uint32_t WindowSize = 256;
+
+	private:
+		std::array<float, WindowSize> m_samples;
+		uint32_t m_cursor;
+		uint32_t m_count;
+
+	public:
+		/**
+		 * Constructor
+		 **/
+		AcheronSampleWindow( );
+
+		/**
+		 * Push method
+		 * @note : Add a sample, replacing the oldest one when full.
+		 * @param sample : Sample value.
+		 **/
+		void Push( const float sample );
+
+		/**
+		 * Clear method
+		 * @note : Remove all samples.
+		 **/
+		void Clear( );
+
+	public:
+		/**
+		 * GetCount const function
+		 * @note : Get current sample count.
+		 * @return Sample count as uint32_t.
+		 **/
+		uint32_t GetCount( ) const;
+
+		/**
+		 * GetLast const function
+		 * @note : Get the most recent sample.
+		 * @return Last sample value or 0 when empty.
+		 **/
+		float GetLast( ) const;
+
+		/**
+		 * GetStats const function
+		 * @note : Get window percentiles, computed on call.
+		 * @return Window percentiles, zeroed when empty.
+		 **/
+		AcheronProfileStats GetStats( ) const;
+
+	};
+
+	struct ACS_API AcheronSystemProfile {
+
+		std::string_view Name;
+		AcheronSampleWindow ProcessTimes;
+		AcheronSampleWindow HookTimes;
+		AcheronSampleWindow EntityCounts;
+
+		/**
+		 * Constructor
+		 **/
+		AcheronSystemProfile( );
+
+		/**
+		 * Record method
+		 * @note : Record a system run.
+		 * @param process_time : Process time in milliseconds.
+		 * @param hook_time : Pre and post process hooks time in milliseconds.
+		 * @param entity_count : Processed entity count.
+		 **/
+		void Record( const float process_time, const float hook_time, const uint32_t entity_count );
+
+	};
+
+	class ACS_API AcheronTrace final {
+
+		struct TraceEvent {
+
+			std::string_view Name;
+			uint64_t Thread;
+			int64_t Start;
+			int64_t Duration;
+			uint32_t EntityCount;
+
+		};
+
+	private:
+		std::mutex m_mutex;
+		std::vector<TraceEvent> m_events;
+		std::chrono::steady_clock::time_point m_start;
+		std::atomic<bool> m_is_recording;
+
+	public:
+		/**
+		 * Constructor
+		 **/
+		AcheronTrace( );
+
+		/**
+		 * Start method
+		 * @note : Drop recorded events and start recording.
+		 **/
+		void Start( );
+
+		/**
+		 * Stop method
+		 * @note : Stop recording, recorded events are kept for Write.
+		 **/
+		void Stop( );
+
+		/**
+		 * Record method
+		 * @note : Record a complete event when recording, thread safe.
+		 * @param name : Event name, must outlive the trace.
+		 * @param start : Event start time.
+		 * @param stop : Event stop time.
+		 * @param entity_count : Processed entity count.
+		 **/
+		void Record(
+			const std::string_view name,
+			const std::chrono::steady_clock::time_point start,
+			const std::chrono::steady_clock::time_point stop,
+			const uint32_t entity_count
+		);
+
+		/**
+		 * Write method
+		 * @note : Write recorded events as Chrome trace event JSON, loadable
+		 *		   in chrome://tracing or Perfetto.
+		 * @param stream : Reference to the output stream.
+		 **/
+		void Write( std::ostream& stream );
+
+	public:
+		/**
+		 * GetIsRecording const function
+		 * @note : Get if the trace is recording.
+		 * @return True when recording.
+		 **/
+		bool GetIsRecording( ) const;
+
+	};
+
+};
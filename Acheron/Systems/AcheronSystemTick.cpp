@@ -0,0 +1,123 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "_acheron_pch.h"
+
+namespace acs {
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	AcheronSystemTick::AcheronSystemTick( )
+		: Policy{ ACS_Tick_Always },
+		Interval{ 1 },
+		MaxSteps{ 1 },
+		Step{ 0.f },
+		Budget{ 0.f },
+		Counter{ 0 },
+		Accumulator{ 0.f },
+		Debt{ 0.f }
+	{
+	}
+
+	AcheronSystemTick AcheronSystemTick::MakeInterval( const uint32_t interval ) {
+		ACS_ASSERT( interval > 0, "Tick interval must be non zero." );
+
+		auto tick = AcheronSystemTick{ };
+
+		tick.Policy	  = ACS_Tick_Interval;
+		tick.Interval = interval;
+
+		return tick;
+	}
+
+	AcheronSystemTick AcheronSystemTick::MakeFixedStep( const float step, const uint32_t max_steps ) {
+		ACS_ASSERT( step > 0.f, "Tick fixed step must be positive." );
+		ACS_ASSERT( max_steps > 0, "Tick fixed step max steps must be non zero." );
+
+		auto tick = AcheronSystemTick{ };
+
+		tick.Policy	  = ACS_Tick_FixedStep;
+		tick.Step	  = step;
+		tick.MaxSteps = max_steps;
+
+		return tick;
+	}
+
+	AcheronSystemTick AcheronSystemTick::MakeBudget( const float budget ) {
+		ACS_ASSERT( budget > 0.f, "Tick budget must be positive." );
+
+		auto tick = AcheronSystemTick{ };
+
+		tick.Policy = ACS_Tick_Budget;
+		tick.Budget = budget;
+
+		return tick;
+	}
+
+	uint32_t AcheronSystemTick::Advance( const float delta_time ) {
+		auto run_count = uint32_t( 1 );
+
+		switch ( Policy ) {
+			case ACS_Tick_Interval :
+				run_count = ( Counter == 0 ) ? 1 : 0;
+				Counter	  = ( Counter + 1 ) % Interval;
+				break;
+
+			case ACS_Tick_FixedStep :
+				Accumulator += delta_time;
+				run_count	 = std::min( uint32_t( Accumulator / Step ), MaxSteps );
+				Accumulator -= float( run_count ) * Step;
+
+				if ( Accumulator >= Step )
+					Accumulator = std::fmod( Accumulator, Step );
+				break;
+
+			case ACS_Tick_Budget :
+				if ( Debt > 0.f ) {
+					Debt	  = std::max( Debt - Budget, 0.f );
+					run_count = 0;
+				}
+				break;
+
+			default : break;
+		}
+
+		return run_count;
+	}
+
+	void AcheronSystemTick::Consume( const float elapsed ) {
+		if ( Policy == ACS_Tick_Budget )
+			Debt = std::max( Debt + elapsed - Budget, 0.f );
+	}
+
+};
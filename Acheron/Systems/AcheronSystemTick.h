@@ -0,0 +1,114 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronSystemHook.h"
+
+namespace acs {
+
+	enum AcheronTickPolicies : uint32_t {
+
+		ACS_Tick_Always = 0,
+		ACS_Tick_Interval,
+		ACS_Tick_FixedStep,
+		ACS_Tick_Budget
+
+	};
+
+	struct ACS_API AcheronSystemTick {
+
+		AcheronTickPolicies Policy;
+		uint32_t Interval;
+		uint32_t MaxSteps;
+		float Step;
+		float Budget;
+		uint32_t Counter;
+		float Accumulator;
+		float Debt;
+
+		/**
+		 * Constructor
+		 * @note : Make a tick policy running the system every tick.
+		 **/
+		AcheronSystemTick( );
+
+		/**
+		 * MakeInterval static function
+		 * @note : Run the system once every interval ticks, starting with
+		 *		   the first tick.
+		 * @param interval : Tick count between two runs, must be non zero.
+		 * @return Interval tick policy.
+		 **/
+		static AcheronSystemTick MakeInterval( const uint32_t interval );
+
+		/**
+		 * MakeFixedStep static function
+		 * @note : Run the system once per elapsed fixed step, elapsed time
+		 *		   is accumulated between ticks.
+		 * @param step : Fixed step duration in seconds, must be positive.
+		 * @param max_steps : Maximum run count per tick, time beyond it is 
+		 *					  dropped so a slow frame can't snowball.
+		 * @return Fixed step tick policy.
+		 **/
+		static AcheronSystemTick MakeFixedStep( const float step, const uint32_t max_steps );
+
+		/**
+		 * MakeBudget static function
+		 * @note : Run the system and skip the following ticks until its 
+		 *		   average cost fit in the budget, expensive systems are 
+		 *		   amortized over several ticks.
+		 * @param budget : Wall clock budget per tick in seconds, must be 
+		 *				   positive.
+		 * @return Budget tick policy.
+		 **/
+		static AcheronSystemTick MakeBudget( const float budget );
+
+		/**
+		 * Advance method
+		 * @note : Advance the policy by one tick.
+		 * @param delta_time : Elapsed time since last tick in seconds.
+		 * @return Count of system runs due this tick.
+		 **/
+		uint32_t Advance( const float delta_time );
+
+		/**
+		 * Consume method
+		 * @note : Account the wall clock time spent by the system runs of a
+		 *		   tick, only used by budget policies.
+		 * @param elapsed : Time spent in seconds.
+		 **/
+		void Consume( const float elapsed );
+
+	};
+
+};
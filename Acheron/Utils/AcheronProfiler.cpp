@@ -0,0 +1,169 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "_acheron_pch.h"
+
+namespace acs {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	INTERNAL ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    static std::atomic<IAcheronProfileBackend*> ProfileBackend{ nullptr };
+
+    static uint64_t GetThreadId( ) {
+        static thread_local const auto thread_id = uint64_t( std::hash<std::thread::id>{ }( std::this_thread::get_id( ) ) );
+
+        return thread_id;
+    }
+
+    static void WriteJsonString( std::ostream& stream, const std::string_view text ) {
+        stream << '"';
+
+        for ( const auto character : text ) {
+            if ( character == '"' || character == '\\' )
+                stream << '\\';
+
+            stream << character;
+        }
+
+        stream << '"';
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    void SetProfileBackend( IAcheronProfileBackend* backend ) {
+        ProfileBackend.store( backend, std::memory_order_release );
+    }
+
+    IAcheronProfileBackend* GetProfileBackend( ) {
+        return ProfileBackend.load( std::memory_order_acquire );
+    }
+
+    AcheronRingTracer::AcheronRingTracer( const uint32_t capacity )
+        : m_events{ },
+        m_cursor{ 0 },
+        m_start{ std::chrono::steady_clock::now( ) }
+    {
+        ACS_ASSERT( capacity > 0, "You can't make a ring tracer without events." );
+
+        m_events.resize( size_t( capacity ) );
+    }
+
+    void AcheronRingTracer::BeginScope( const std::string_view name ) {
+        Record( name, 'B', 0 );
+    }
+
+    void AcheronRingTracer::EndScope( const std::string_view name ) {
+        Record( name, 'E', 0 );
+    }
+
+    void AcheronRingTracer::Counter( const std::string_view name, const int64_t value ) {
+        Record( name, 'C', value );
+    }
+
+    void AcheronRingTracer::Clear( ) {
+        m_cursor.store( 0, std::memory_order_relaxed );
+
+        m_start = std::chrono::steady_clock::now( );
+    }
+
+    void AcheronRingTracer::Write( std::ostream& stream ) const {
+        const auto cursor   = m_cursor.load( std::memory_order_acquire );
+        const auto capacity = uint64_t( m_events.size( ) );
+        const auto first    = cursor > capacity ? cursor - capacity : uint64_t( 0 );
+        auto depths   = std::unordered_map<uint64_t, uint32_t>{ };
+        auto is_first = true;
+
+        stream << "{\"traceEvents\":[";
+
+        for ( auto index = first; index < cursor; index++ ) {
+            const auto& event = m_events[ size_t( index % capacity ) ];
+            auto& depth = depths[ event.Thread ];
+
+            if ( event.Phase == 'B' )
+                depth += 1;
+            else if ( event.Phase == 'E' ) {
+                if ( depth == 0 )
+                    continue;
+
+                depth -= 1;
+            }
+
+            if ( !is_first )
+                stream << ',';
+
+            stream << "{\"name\":";
+            WriteJsonString( stream, event.Name );
+            stream << ",\"cat\":\"acs\",\"ph\":\"" << event.Phase << "\",\"pid\":0"
+                << ",\"tid\":" << event.Thread
+                << ",\"ts\":" << double( event.Time ) / 1000.0;
+
+            if ( event.Phase == 'C' ) {
+                stream << ",\"args\":{";
+                WriteJsonString( stream, event.Name );
+                stream << ':' << event.Value << '}';
+            }
+
+            stream << '}';
+
+            is_first = false;
+        }
+
+        stream << "],\"displayTimeUnit\":\"ms\"}";
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PRIVATE ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    void AcheronRingTracer::Record( const std::string_view name, const char phase, const int64_t value ) {
+        const auto now  = std::chrono::steady_clock::now( );
+        const auto slot = m_cursor.fetch_add( 1, std::memory_order_relaxed ) % uint64_t( m_events.size( ) );
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>( now - m_start ).count( );
+
+        m_events[ size_t( slot ) ] = TraceEvent{ name, GetThreadId( ), int64_t( time ), value, phase };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //		===	PUBLIC GET ===
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t AcheronRingTracer::GetCount( ) const {
+        const auto cursor = m_cursor.load( std::memory_order_acquire );
+
+        return uint32_t( std::min( cursor, uint64_t( m_events.size( ) ) ) );
+    }
+
+    uint32_t AcheronRingTracer::GetCapacity( ) const {
+        return uint32_t( m_events.size( ) );
+    }
+
+};
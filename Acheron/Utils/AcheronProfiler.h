@@ -0,0 +1,228 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "AcheronTraits.h"
+
+namespace acs {
+
+    struct IAcheronProfileBackend {
+
+        /**
+         * Destructor
+         **/
+        virtual ~IAcheronProfileBackend( ) = default;
+
+        /**
+         * BeginScope pure-virtual method
+         * @note : Called when an ACS_PROFILE_SCOPE is entered, from any 
+         *         thread.
+         * @param name : Scope name.
+         **/
+        virtual void BeginScope( const std::string_view name ) = 0;
+
+        /**
+         * EndScope pure-virtual method
+         * @note : Called when an ACS_PROFILE_SCOPE is left, on the thread
+         *         that entered it.
+         * @param name : Scope name.
+         **/
+        virtual void EndScope( const std::string_view name ) = 0;
+
+        /**
+         * Counter pure-virtual method
+         * @note : Called for each ACS_PROFILE_COUNTER, from any thread.
+         * @param name : Counter name.
+         * @param value : Counter value.
+         **/
+        virtual void Counter( const std::string_view name, const int64_t value ) = 0;
+
+    };
+
+    /**
+     * SetProfileBackend function
+     * @note : Set the backend receiving ACS_PROFILE_SCOPE and 
+     *         ACS_PROFILE_COUNTER events, nullptr to drop them. Change it 
+     *         while no acs work is running, the backend must outlive its
+     *         use.
+     * @param backend : Pointer to the profile backend.
+     **/
+    ACS_API void SetProfileBackend( IAcheronProfileBackend* backend );
+
+    /**
+     * GetProfileBackend function
+     * @note : Get the current profile backend.
+     * @return Pointer to the profile backend, nullptr when none is set.
+     **/
+    ACS_API IAcheronProfileBackend* GetProfileBackend( );
+
+    /**
+     * ProfileCounter function
+     * @note : Send a counter value to the current profile backend.
+     * @param name : Counter name.
+     * @param value : Counter value.
+     **/
+    inline void ProfileCounter( const std::string_view name, const int64_t value ) {
+        if ( auto* backend = GetProfileBackend( ) )
+            backend->Counter( name, value );
+    };
+
+    class ACS_API AcheronProfileScope final {
+
+    private:
+        IAcheronProfileBackend* m_backend;
+        std::string_view m_name;
+
+    public:
+        /**
+         * Constructor
+         * @param name : Scope name, must outlive the backend use.
+         **/
+        AcheronProfileScope( const std::string_view name )
+            : m_backend{ GetProfileBackend( ) },
+            m_name{ name }
+        {
+            if ( m_backend )
+                m_backend->BeginScope( m_name );
+        };
+
+        /**
+         * Destructor
+         **/
+        ~AcheronProfileScope( ) {
+            if ( m_backend )
+                m_backend->EndScope( m_name );
+        };
+
+        AcheronProfileScope( const AcheronProfileScope& ) = delete;
+        AcheronProfileScope& operator=( const AcheronProfileScope& ) = delete;
+
+    };
+
+    class ACS_API AcheronRingTracer final 
+        : public IAcheronProfileBackend
+    {
+
+        struct TraceEvent {
+
+            std::string_view Name;
+            uint64_t Thread;
+            int64_t Time;
+            int64_t Value;
+            char Phase;
+
+        };
+
+    private:
+        std::vector<TraceEvent> m_events;
+        std::atomic<uint64_t> m_cursor;
+        std::chrono::steady_clock::time_point m_start;
+
+    public:
+        /**
+         * Constructor
+         * @param capacity : Event count kept, older events are overwritten.
+         **/
+        AcheronRingTracer( const uint32_t capacity );
+
+        /**
+         * Destructor
+         **/
+        virtual ~AcheronRingTracer( ) = default;
+
+        /**
+         * BeginScope override method
+         * @note : Record a scope begin event, lock free.
+         * @param name : Scope name.
+         **/
+        virtual void BeginScope( const std::string_view name ) override;
+
+        /**
+         * EndScope override method
+         * @note : Record a scope end event, lock free.
+         * @param name : Scope name.
+         **/
+        virtual void EndScope( const std::string_view name ) override;
+
+        /**
+         * Counter override method
+         * @note : Record a counter event, lock free.
+         * @param name : Counter name.
+         * @param value : Counter value.
+         **/
+        virtual void Counter( const std::string_view name, const int64_t value ) override;
+
+        /**
+         * Clear method
+         * @note : Drop recorded events, must not run concurrently with 
+         *         recording.
+         **/
+        void Clear( );
+
+        /**
+         * Write const method
+         * @note : Write recorded events from oldest to newest as Chrome 
+         *         trace event JSON, end events whose begin was overwritten
+         *         are skipped. Must not run concurrently with recording.
+         * @param stream : Reference to the output stream.
+         **/
+        void Write( std::ostream& stream ) const;
+
+    private:
+        /**
+         * Record method
+         * @note : Claim the next ring slot and write an event in it.
+         * @param name : Event name.
+         * @param phase : Chrome trace event phase.
+         * @param value : Counter value.
+         **/
+        void Record( const std::string_view name, const char phase, const int64_t value );
+
+    public:
+        /**
+         * GetCount const function
+         * @note : Get recorded event count, capped to the capacity.
+         * @return Recorded event count as uint32_t.
+         **/
+        uint32_t GetCount( ) const;
+
+        /**
+         * GetCapacity const function
+         * @note : Get maximum recorded event count.
+         * @return Maximum recorded event count as uint32_t.
+         **/
+        uint32_t GetCapacity( ) const;
+
+    };
+
+};
@@ -12,15 +12,27 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
+#include <deque>
 #include <functional>
+#include <iostream>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <unordered_map>
 #include <vector>
 #include <source_location>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 
 
 // Ensure C++20 use
@@ -37,6 +49,11 @@
 #   define ACS_API
 #endif
 
+// Define ACS_ENABLE_PROFILING to record per system timings, entity counts
+// and Chrome traces in AcheronSystemManager, and to send ACS_PROFILE_SCOPE
+// and ACS_PROFILE_COUNTER events to the profile backend, compiled out 
+// otherwise.
+
 /**
  * ACS_ASSERT macro
  * @note Defined the assertion macro if user don't provide one.
@@ -59,7 +76,41 @@
                 }\
             } while( false );
 #   else
-#       define ACS_ASSERT( COND, MESSAGE ) ( (void)COND );
+#       define ACS_ASSERT( COND, MESSAGE ) ( (void)( COND ) );
+#   endif
+#endif
+
+/**
+ * ACS_PROFILE_SCOPE macro
+ * @note Defined the scope profiling macro if user don't provide one, the 
+ *       enclosing scope is reported to the profile backend set with 
+ *       acs::SetProfileBackend.
+ * @param NAME : Scope name, must outlive the backend use.
+ **/
+#ifndef ACS_PROFILE_SCOPE
+#   if defined( ACS_ENABLE_PROFILING )
+#       define ACS_PROFILE_CONCAT_IMPL( A, B ) A##B
+#       define ACS_PROFILE_CONCAT( A, B ) ACS_PROFILE_CONCAT_IMPL( A, B )
+#       define ACS_PROFILE_SCOPE( NAME )\
+            const auto ACS_PROFILE_CONCAT( acs_profile_scope_, __LINE__ ) = acs::AcheronProfileScope{ NAME }
+#   else
+#       define ACS_PROFILE_SCOPE( NAME )
+#   endif
+#endif
+
+/**
+ * ACS_PROFILE_COUNTER macro
+ * @note Defined the counter profiling macro if user don't provide one, the
+ *       value is reported to the profile backend and isn't evaluated when
+ *       profiling is disabled.
+ * @param NAME : Counter name, must outlive the backend use.
+ * @param VALUE : Counter value.
+ **/
+#ifndef ACS_PROFILE_COUNTER
+#   if defined( ACS_ENABLE_PROFILING )
+#       define ACS_PROFILE_COUNTER( NAME, VALUE ) acs::ProfileCounter( NAME, int64_t( VALUE ) )
+#   else
+#       define ACS_PROFILE_COUNTER( NAME, VALUE )
 #   endif
 #endif
 
@@ -71,6 +122,9 @@ namespace acs {
     // Defined offset for internal vector resize operation.
     static uint32_t StorageOffset = StorageSize / 2;
 
+    // Defined cache line size used to split parallel work without false sharing.
+    static constexpr uint32_t CacheLineSize = 64;
+
     /**
      * SetCapacity method
      * @note : Call this function before any acs object creation to 
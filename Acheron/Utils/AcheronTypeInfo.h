@@ -0,0 +1,152 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once 
+
+#include "AcheronTraits.h"
+
+namespace acs {
+
+    /**
+     * GetTypeName template function
+     * @note : Get the compiler name of a type at compile time.
+     * @template Type : Target type.
+     * @return Type name as string view.
+     **/
+    template<typename Type>
+    constexpr std::string_view GetTypeName( ) {
+#   if defined( _MSC_VER ) && !defined( __clang__ )
+        constexpr auto signature = std::string_view{ __FUNCSIG__ };
+        constexpr auto prefix    = std::string_view{ "GetTypeName<" };
+        constexpr auto suffix    = std::string_view{ ">(void)" };
+#   else
+        constexpr auto signature = std::string_view{ __PRETTY_FUNCTION__ };
+        constexpr auto prefix    = std::string_view{ "Type = " };
+        constexpr auto suffix    = std::string_view{ "]" };
+#   endif
+        constexpr auto start = signature.find( prefix ) + prefix.size( );
+        constexpr auto stop  = signature.rfind( suffix );
+        constexpr auto name  = signature.substr( start, stop - start );
+
+        // GCC append the aliases after the type : "Type = T; std::string_view = ...".
+        return name.substr( 0, name.find( ';' ) );
+    };
+
+    /**
+     * HashTypeName function
+     * @note : Hash a type name using 64 bits FNV-1a, spaces and the
+     *         struct, class, enum and union keywords are skipped. Hashes
+     *         are stable across runs and builds of the same compiler, 
+     *         other spellings like anonymous namespaces, default template
+     *         arguments or literal suffixes still differ between 
+     *         compilers.
+     * @param name : Type name.
+     * @return Type name hash.
+     **/
+    constexpr uint64_t HashTypeName( const std::string_view name ) {
+        constexpr std::string_view keywords[] = { "struct ", "class ", "enum ", "union " };
+
+        auto is_identifier = []( const char character ) -> bool {
+            return ( character >= 'a' && character <= 'z' ) 
+                || ( character >= 'A' && character <= 'Z' ) 
+                || ( character >= '0' && character <= '9' ) 
+                || character == '_';
+        };
+        auto hash  = uint64_t( 0xcbf29ce484222325 );
+        auto index = size_t( 0 );
+
+        while ( index < name.size( ) ) {
+            const auto is_token_start = index == 0 || !is_identifier( name[ index - 1 ] );
+            auto is_keyword = false;
+
+            for ( const auto keyword : keywords ) {
+                if ( is_token_start && name.substr( index, keyword.size( ) ) == keyword ) {
+                    index     += keyword.size( );
+                    is_keyword = true;
+
+                    break;
+                }
+            }
+
+            if ( is_keyword )
+                continue;
+
+            if ( name[ index ] != ' ' ) {
+                hash ^= uint64_t( uint8_t( name[ index ] ) );
+                hash *= uint64_t( 0x100000001b3 );
+            }
+
+            index += 1;
+        }
+
+        return hash;
+    };
+
+    /**
+     * GetTypeHash template function
+     * @note : Get a stable 64 bits hash of a type, const and volatile 
+     *         qualifiers are ignored.
+     * @template Type : Target type.
+     * @return Type hash.
+     **/
+    template<typename Type>
+    constexpr uint64_t GetTypeHash( ) {
+        return HashTypeName( GetTypeName<std::remove_cv_t<Type>>( ) );
+    };
+
+    /**
+     * CombineTypeHashes template function
+     * @note : Combine a list of type hashes, hashes are sorted first so 
+     *         the result don't depend on the list order, the list size is
+     *         used as seed so duplicated types don't cancel each other.
+     * @template Types : Target types.
+     * @return Combined type hash.
+     **/
+    template<typename... Types>
+    constexpr uint64_t CombineTypeHashes( ) {
+        auto hashes = std::array<uint64_t, sizeof...( Types )>{ GetTypeHash<Types>( )... };
+        auto result = uint64_t( 0x9e3779b97f4a7c15 ) * ( sizeof...( Types ) + 1 );
+
+        std::sort( hashes.begin( ), hashes.end( ) );
+
+        for ( const auto hash : hashes ) {
+            // SplitMix64 finalizer.
+            result ^= hash;
+            result  = ( result ^ ( result >> 30 ) ) * uint64_t( 0xbf58476d1ce4e5b9 );
+            result  = ( result ^ ( result >> 27 ) ) * uint64_t( 0x94d049bb133111eb );
+            result  = result ^ ( result >> 31 );
+        }
+
+        return result;
+    };
+
+};
@@ -34,24 +34,6 @@
 
 namespace acs {
 
-    ////////////////////////////////////////////////////////////////////////////////////////////
-    //		===	PUBLIC ===
-    ////////////////////////////////////////////////////////////////////////////////////////////
-    AcheronUUID::AcheronUUID( )
-        : AcheronUUID{ UINT32_MAX, UINT32_MAX }
-    { 
-    }
-
-    AcheronUUID::AcheronUUID( const uint64_t uuid )
-        : Value{ uuid } 
-    { 
-    }
-
-    AcheronUUID::AcheronUUID( const uint32_t index, const uint32_t generation )
-        : Value{ uint64_t( generation ) << 32 | index }
-    { 
-    }
-
     ////////////////////////////////////////////////////////////////////////////////////////////
     //		===	PUBLIC GET ===
     ////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,28 +52,4 @@ namespace acs {
         return Value;
     }
 
-    bool AcheronUUID::operator<( const AcheronUUID& other ) const {
-        return Value < other.Value;
-    }
-
-    bool AcheronUUID::operator<=( const AcheronUUID& other ) const {
-        return Value <= other.Value;
-    }
-
-    bool AcheronUUID::operator>( const AcheronUUID& other ) const {
-        return Value > other.Value;
-    }
-
-    bool AcheronUUID::operator>=( const AcheronUUID& other ) const {
-        return Value >= other.Value;
-    }
-
-    bool AcheronUUID::operator==( const AcheronUUID& other ) const {
-        return Value == other.Value;
-    }
-
-    bool AcheronUUID::operator!=( const AcheronUUID& other ) const {
-        return !( *this == other );
-    }
-
 };
@@ -32,7 +32,7 @@
 
 #pragma once 
 
-#include "AcheronTraits.h"
+#include "AcheronTypeInfo.h"
 
 namespace acs {
 
@@ -43,14 +43,18 @@ namespace acs {
         /**
          * Constructor
          **/
-        AcheronUUID( );
+        constexpr AcheronUUID( )
+            : AcheronUUID{ UINT32_MAX, UINT32_MAX }
+        { };
 
         /**
          * Constructor
          * @note : Used internaly to build UUID from uint64_t.
          * @param other : Target UUID value.
          **/
-        AcheronUUID( const uint64_t uuid );
+        constexpr AcheronUUID( const uint64_t uuid )
+            : Value{ uuid }
+        { };
 
         /**
          * Constructor
@@ -58,7 +62,9 @@ namespace acs {
          * @param index : Base entity index.
          * @param generation : Base entity generation.
          **/
-        AcheronUUID( const uint32_t index, const uint32_t generation );
+        constexpr AcheronUUID( const uint32_t index, const uint32_t generation )
+            : Value{ uint64_t( generation ) << 32 | index }
+        { };
 
         /**
          * GetIsValid constant function
@@ -69,15 +75,16 @@ namespace acs {
 
         /**
          * Make static template function
-         * @note : Get AcheronUUID for any type.
-         * @template Type : Target type for UUID generation.
-         * @return Return the AcheronUUID of the targeted Type.
+         * @note : Get AcheronUUID for any type list at compile time, the 
+         *         UUID is derived from the type names so it's stable across
+         *         runs of a same compiler and don't depend on the list 
+         *         order.
+         * @template Types : Target types for UUID generation.
+         * @return Return the AcheronUUID of the targeted Types.
          **/
         template<typename... Types>
-        static AcheronUUID Make( ) {
-            const auto uuid = ( uint64_t( typeid( Types ).hash_code( ) ) ^ ... );
-
-            return { uuid };
+        static constexpr AcheronUUID Make( ) {
+            return { CombineTypeHashes<Types...>( ) };
         };
 
         /**
@@ -94,17 +101,29 @@ namespace acs {
          **/
         operator uint64_t ( ) const;
 
-        bool operator<( const AcheronUUID& other ) const;
+        constexpr bool operator<( const AcheronUUID& other ) const {
+            return Value < other.Value;
+        };
 
-        bool operator<=( const AcheronUUID& other ) const;
+        constexpr bool operator<=( const AcheronUUID& other ) const {
+            return Value <= other.Value;
+        };
 
-        bool operator>( const AcheronUUID& other ) const;
+        constexpr bool operator>( const AcheronUUID& other ) const {
+            return Value > other.Value;
+        };
 
-        bool operator>=( const AcheronUUID& other ) const;
+        constexpr bool operator>=( const AcheronUUID& other ) const {
+            return Value >= other.Value;
+        };
 
-        bool operator==( const AcheronUUID& other ) const;
+        constexpr bool operator==( const AcheronUUID& other ) const {
+            return Value == other.Value;
+        };
 
-        bool operator!=( const AcheronUUID& other ) const;
+        constexpr bool operator!=( const AcheronUUID& other ) const {
+            return !( *this == other );
+        };
 
     };
 
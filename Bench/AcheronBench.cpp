@@ -0,0 +1,605 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "AcheronBench_Scenario.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	COMPONENTS ===
+////////////////////////////////////////////////////////////////////////////////////////////
+namespace acs_bench {
+
+	template<uint32_t Id>
+	struct BenchComp {
+
+		float Value = 1.f;
+
+	};
+
+	struct SparseComp {
+
+		float Value = 1.f;
+
+	};
+
+	struct EmptyComp { };
+
+	struct BodyComp {
+
+		float X = 0.f;
+		float Y = 0.f;
+		float Z = 0.f;
+		float VX = 1.f;
+		float VY = 1.f;
+		float VZ = 1.f;
+		float Padding[ 10 ] = { };
+
+	};
+
+	struct FieldBodyComp {
+
+		float X = 0.f;
+		float Y = 0.f;
+		float Z = 0.f;
+		float VX = 1.f;
+		float VY = 1.f;
+		float VZ = 1.f;
+
+	};
+
+	using CompA = BenchComp<0>;
+	using CompB = BenchComp<1>;
+	using CompC = BenchComp<2>;
+	using CompD = BenchComp<3>;
+
+};
+
+namespace acs {
+
+	template<>
+	struct AcheronComponentTraits<acs_bench::SparseComp> {
+
+		static constexpr AcheronStorageTypes Storage = ACS_Storage_Sparse;
+
+	};
+
+	template<>
+	struct AcheronComponentTraits<acs_bench::EmptyComp> {
+
+		static constexpr AcheronStorageTypes Storage = ACS_Storage_Empty;
+
+	};
+
+	template<>
+	struct AcheronComponentTraits<acs_bench::FieldBodyComp> {
+
+		using Type = acs_bench::FieldBodyComp;
+
+		static constexpr AcheronStorageTypes Storage = ACS_Storage_Fields;
+		static constexpr auto Fields = std::make_tuple( &Type::X, &Type::Y, &Type::Z, &Type::VX, &Type::VY, &Type::VZ );
+
+	};
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	SCENARIOS ===
+////////////////////////////////////////////////////////////////////////////////////////////
+namespace acs_bench {
+
+	using Context = std::unique_ptr<acs::AcheronComponentSystem>;
+
+	// Written by view benches so iterations aren't optimized out.
+	static volatile float Sink = 0.f;
+
+	class MoveSystem
+		: public acs::AcheronSystem<CompA, const CompB>
+	{
+
+	public:
+		MoveSystem( const uint32_t parallel_grain )
+			: acs::AcheronSystem<CompA, const CompB>{ parallel_grain }
+		{ };
+
+	protected:
+		virtual void OnProcessBatch(
+			acs::AcheronContext&,
+			void*,
+			std::span<const acs::AcheronUUID> entities,
+			std::span<CompA> positions,
+			std::span<const CompB> velocities
+		) override {
+			for ( auto index = size_t( 0 ); index < entities.size( ); index++ )
+				positions[ index ].Value += velocities[ index ].Value;
+		};
+
+	};
+
+	/**
+	 * MakeContext function
+	 * @note : Make a context with count entities owning CompTypes.
+	 * @template CompTypes : Component types appended to each entity.
+	 * @param count : Entity count.
+	 * @param entities : Reference to the created entities.
+	 * @param worker_count : Job system worker count.
+	 * @return Context instance.
+	 **/
+	template<typename... CompTypes>
+	Context MakeContext( const uint32_t count, std::vector<acs::AcheronUUID>& entities, const uint32_t worker_count ) {
+		auto context = std::make_unique<acs::AcheronComponentSystem>( );
+
+		entities.resize( size_t( count ) );
+
+		context->ResizeWorkerPool( worker_count );
+		context->Create( count, entities );
+
+		( [ & ]( ) -> void {
+			auto components = std::vector<CompTypes>( size_t( count ) );
+
+			context->AppendRange<CompTypes>( entities, components );
+		}( ), ... );
+
+		return context;
+	}
+
+	/**
+	 * BenchEntities function
+	 * @note : Bench entity creation and destruction.
+	 **/
+	void BenchEntities( AcheronBench& bench, const uint32_t count ) {
+		auto context  = Context{ };
+		auto entities = std::vector<acs::AcheronUUID>( size_t( count ) );
+		const auto workers = bench.GetOptions( ).WorkerCount;
+
+		bench.Run( "Entity/Create", count, count, 
+			[ & ]( ) { context = std::make_unique<acs::AcheronComponentSystem>( ); },
+			[ & ]( ) { context->Create( count, entities ); }
+		);
+
+		bench.Run( "Entity/Destroy", count, count,
+			[ & ]( ) { context = MakeContext<>( count, entities, workers ); },
+			[ & ]( ) { context->Destroy( entities, false ); }
+		);
+	}
+
+	/**
+	 * BenchComponents function
+	 * @note : Bench per storage type component append and remove. Sorted 
+	 *		   removes run from the last entity, removing from the front 
+	 *		   of a sorted storage is O(n) per call, RemoveRange covers it.
+	 * @template CompType : Component type.
+	 * @param storage_name : Storage name used in bench names.
+	 **/
+	template<typename CompType>
+	void BenchComponents( AcheronBench& bench, const uint32_t count, const std::string& storage_name ) {
+		auto context  = Context{ };
+		auto entities = std::vector<acs::AcheronUUID>( size_t( count ) );
+		const auto workers = bench.GetOptions( ).WorkerCount;
+
+		bench.Run( "Component/Append<" + storage_name + ">", count, count,
+			[ & ]( ) { context = MakeContext<>( count, entities, workers ); },
+			[ & ]( ) {
+				for ( const auto entity : entities )
+					context->Append( entity, CompType{ } );
+			}
+		);
+
+		bench.Run( "Component/AppendRange<" + storage_name + ">", count, count,
+			[ & ]( ) { context = MakeContext<>( count, entities, workers ); },
+			[ & ]( ) {
+				auto components = std::vector<CompType>( size_t( count ) );
+
+				context->AppendRange<CompType>( entities, components );
+			}
+		);
+
+		bench.Run( "Component/Remove<" + storage_name + ">", count, count,
+			[ & ]( ) { context = MakeContext<CompType>( count, entities, workers ); },
+			[ & ]( ) {
+				for ( auto entity = entities.rbegin( ); entity != entities.rend( ); ++entity )
+					context->Remove<CompType>( *entity );
+			}
+		);
+
+		bench.Run( "Component/RemoveRange<" + storage_name + ">", count, count,
+			[ & ]( ) { context = MakeContext<CompType>( count, entities, workers ); },
+			[ & ]( ) { context->RemoveRange<CompType>( entities ); }
+		);
+	}
+
+	/**
+	 * BenchView function
+	 * @note : Bench a view iteration over a warm cache.
+	 * @template CompTypes : View component types.
+	 **/
+	template<typename... CompTypes>
+	void BenchView( AcheronBench& bench, acs::AcheronComponentSystem& context, const uint32_t count ) {
+		const auto name = "View/Each<" + std::to_string( sizeof...( CompTypes ) ) + ">";
+
+		bench.Run( name, count, count, nullptr, [ & ]( ) {
+			auto sum = 0.f;
+
+			for ( const auto components : acs::AcheronComponentView<CompTypes...>( context, context ) ) {
+				sum += std::apply( [ ]( const acs::AcheronUUID, auto*... values ) -> float {
+					return ( values->Value + ... );
+				}, components );
+			}
+
+			Sink = sum;
+		} );
+	}
+
+	/**
+	 * BenchViews function
+	 * @note : Bench views of 1 to 4 components and their cache.
+	 **/
+	void BenchViews( AcheronBench& bench, const uint32_t count ) {
+		auto entities = std::vector<acs::AcheronUUID>{ };
+		auto context  = MakeContext<CompA, CompB, CompC, CompD>( count, entities, bench.GetOptions( ).WorkerCount );
+		auto& component_cache = context->GetComponentCache( );
+
+		BenchView<CompA>( bench, *context, count );
+		BenchView<CompA, CompB>( bench, *context, count );
+		BenchView<CompA, CompB, CompC>( bench, *context, count );
+		BenchView<CompA, CompB, CompC, CompD>( bench, *context, count );
+
+		bench.Run( "View/EachBatch<4>", count, count, nullptr, [ & ]( ) {
+			auto sum = 0.f;
+
+			acs::AcheronComponentView<CompA, CompB, CompC, CompD>( *context, *context ).EachBatch( 
+				[ & ]( std::span<const acs::AcheronUUID> uuids, std::span<CompA> a, std::span<CompB> b, std::span<CompC> c, std::span<CompD> d ) {
+					for ( auto index = size_t( 0 ); index < uuids.size( ); index++ )
+						sum += a[ index ].Value + b[ index ].Value + c[ index ].Value + d[ index ].Value;
+				}
+			);
+
+			Sink = sum;
+		} );
+
+		bench.Run( "Cache/Rebuild<4>", count, count, nullptr, [ & ]( ) {
+			auto cache = acs::AcheronComponentCache{ };
+
+			Sink = float( cache.Get<CompA, CompB, CompC, CompD>( *context ).size( ) );
+		} );
+
+		// One percent of the entities lose and get back a component before
+		// each repetition, the cache applies the storage change logs.
+		const auto step = std::max( count / 100, 1u );
+		auto changed	= std::vector<acs::AcheronUUID>{ };
+
+		for ( auto index = size_t( 0 ); index < entities.size( ); index += step )
+			changed.emplace_back( entities[ index ] );
+
+		bench.Run( "Cache/Update<4>", count, count, 
+			[ & ]( ) {
+				auto components = std::vector<CompD>( changed.size( ) );
+
+				context->RemoveRange<CompD>( changed );
+				context->AppendRange<CompD>( changed, components );
+			}, 
+			[ & ]( ) { Sink = float( component_cache.Get<CompA, CompB, CompC, CompD>( *context ).size( ) ); }
+		);
+	}
+
+	/**
+	 * BenchIntegrate function
+	 * @note : Bench a position integration over 64 bytes body structs 
+	 *		   against the same body stored field by field.
+	 **/
+	void BenchIntegrate( AcheronBench& bench, const uint32_t count ) {
+		auto entities = std::vector<acs::AcheronUUID>( size_t( count ) );
+		auto context  = MakeContext<BodyComp, FieldBodyComp>( count, entities, bench.GetOptions( ).WorkerCount );
+
+		bench.Run( "Integrate<Struct>", count, count, nullptr, [ & ]( ) {
+			acs::AcheronComponentView<BodyComp>( *context, *context ).EachBatch( 
+				[ ]( std::span<const acs::AcheronUUID>, std::span<BodyComp> bodies ) {
+					for ( auto& body : bodies ) {
+						body.X += body.VX * 0.016f;
+						body.Y += body.VY * 0.016f;
+						body.Z += body.VZ * 0.016f;
+					}
+				}
+			);
+		} );
+
+		bench.Run( "Integrate<Fields>", count, count, nullptr, [ & ]( ) {
+			acs::AcheronComponentView<FieldBodyComp>( *context, *context ).EachBatch( 
+				[ ]( std::span<const acs::AcheronUUID>, acs::AcheronFieldSpan<FieldBodyComp> bodies ) {
+					const auto integrate = [ ]( std::span<float> positions, std::span<float> velocities ) -> void {
+						for ( auto index = size_t( 0 ); index < positions.size( ); index++ )
+							positions[ index ] += velocities[ index ] * 0.016f;
+					};
+
+					integrate( bodies.Get<&FieldBodyComp::X>( ), bodies.Get<&FieldBodyComp::VX>( ) );
+					integrate( bodies.Get<&FieldBodyComp::Y>( ), bodies.Get<&FieldBodyComp::VY>( ) );
+					integrate( bodies.Get<&FieldBodyComp::Z>( ), bodies.Get<&FieldBodyComp::VZ>( ) );
+				}
+			);
+		} );
+	}
+
+	/**
+	 * BenchTags function
+	 * @note : Bench skipping ignored entities with a branch per entity 
+	 *		   against a tag filtered view, one entity on four is ignored
+	 *		   by groups of 256 like entities spawned together. The filter
+	 *		   cost is included in the filtered view time.
+	 **/
+	void BenchTags( AcheronBench& bench, const uint32_t count ) {
+		auto entities = std::vector<acs::AcheronUUID>( size_t( count ) );
+		auto context  = MakeContext<BodyComp>( count, entities, bench.GetOptions( ).WorkerCount );
+
+		for ( auto index = size_t( 0 ); index < entities.size( ); index++ ) {
+			if ( ( index / 256 ) % 4 == 0 )
+				context->GetComponent<acs::AcheronTag>( entities[ index ] )->Flags |= acs::ACS_Ignore;
+		}
+
+		bench.Run( "Tags/Branch", count, count, nullptr, [ & ]( ) {
+			acs::AcheronComponentView<BodyComp, const acs::AcheronTag>( *context, *context ).EachBatch( 
+				[ ]( std::span<const acs::AcheronUUID>, std::span<BodyComp> bodies, std::span<const acs::AcheronTag> tags ) {
+					for ( auto index = size_t( 0 ); index < bodies.size( ); index++ ) {
+						if ( tags[ index ].Flags & acs::ACS_Ignore )
+							continue;
+
+						bodies[ index ].X += bodies[ index ].VX * 0.016f;
+					}
+				}
+			);
+		} );
+
+		bench.Run( "Tags/Filter", count, count, nullptr, [ & ]( ) {
+			acs::AcheronComponentView<BodyComp>( *context, *context ).WithTags( acs::ACS_Ignore, false ).EachBatch( 
+				[ ]( std::span<const acs::AcheronUUID>, std::span<BodyComp> bodies ) {
+					for ( auto& body : bodies )
+						body.X += body.VX * 0.016f;
+				}
+			);
+		} );
+	}
+
+	/**
+	 * BenchSweep function
+	 * @note : Bench deferred destruction of every entity.
+	 **/
+	void BenchSweep( AcheronBench& bench, const uint32_t count ) {
+		auto context  = Context{ };
+		auto entities = std::vector<acs::AcheronUUID>{ };
+		const auto workers = bench.GetOptions( ).WorkerCount;
+
+		bench.Run( "Sweep", count, count,
+			[ & ]( ) {
+				context = MakeContext<CompA, CompB, SparseComp>( count, entities, workers );
+				context->Destroy( entities, true );
+			},
+			[ & ]( ) { context->Sweep( ); }
+		);
+	}
+
+	/**
+	 * BenchSystems function
+	 * @note : Bench serial and parallel system processing.
+	 **/
+	void BenchSystems( AcheronBench& bench, const uint32_t count ) {
+		auto entities = std::vector<acs::AcheronUUID>{ };
+		auto serial	  = MakeContext<CompA, CompB>( count, entities, bench.GetOptions( ).WorkerCount );
+		auto parallel = MakeContext<CompA, CompB>( count, entities, bench.GetOptions( ).WorkerCount );
+
+		serial->Register<MoveSystem>( true, 0u );
+		parallel->Register<MoveSystem>( true, 4096u );
+
+		bench.Run( "System/Process", count, count, nullptr, [ & ]( ) { serial->Process( nullptr, 0.f ); } );
+		bench.Run( "System/ParallelProcess", count, count, nullptr, [ & ]( ) { parallel->Process( nullptr, 0.f ); } );
+	}
+
+	using ArchetypeContext = std::unique_ptr<acs::AcheronArchetypeContext>;
+
+	/**
+	 * MakeArchetypeContext function
+	 * @note : Make an archetype context with count entities owning 
+	 *		   CompTypes, each append move the entities to the next 
+	 *		   archetype.
+	 * @template CompTypes : Component types appended to each entity.
+	 * @param count : Entity count.
+	 * @param entities : Reference to the created entities.
+	 * @param job_system : Pointer to the context job system.
+	 * @return Archetype context instance.
+	 **/
+	template<typename... CompTypes>
+	ArchetypeContext MakeArchetypeContext( const uint32_t count, std::vector<acs::AcheronUUID>& entities, acs::AcheronJobSystem* job_system ) {
+		auto context = std::make_unique<acs::AcheronArchetypeContext>( );
+
+		entities.resize( size_t( count ) );
+
+		context->SetJobSystem( job_system );
+		context->Create( count, entities );
+
+		( [ & ]( ) -> void {
+			for ( const auto entity : entities )
+				context->Append( entity, CompTypes{ } );
+		}( ), ... );
+
+		return context;
+	}
+
+	/**
+	 * BenchArchetypeView function
+	 * @note : Bench an archetype view iteration, view construction 
+	 *		   included.
+	 * @template CompTypes : View component types.
+	 **/
+	template<typename... CompTypes>
+	void BenchArchetypeView( AcheronBench& bench, acs::AcheronArchetypeContext& context, const uint32_t count ) {
+		const auto name = "Archetype/View/Each<" + std::to_string( sizeof...( CompTypes ) ) + ">";
+
+		bench.Run( name, count, count, nullptr, [ & ]( ) {
+			auto sum = 0.f;
+
+			for ( const auto components : acs::AcheronArchetypeView<CompTypes...>( context ) ) {
+				sum += std::apply( [ ]( const acs::AcheronUUID, auto*... values ) -> float {
+					return ( values->Value + ... );
+				}, components );
+			}
+
+			Sink = sum;
+		} );
+	}
+
+	/**
+	 * BenchArchetypes function
+	 * @note : Bench the archetype context against the storage benches 
+	 *		   above, names mirror the storage ones under Archetype/.
+	 **/
+	void BenchArchetypes( AcheronBench& bench, const uint32_t count ) {
+		auto job_system = acs::AcheronJobSystem{ };
+		auto context	= ArchetypeContext{ };
+		auto entities	= std::vector<acs::AcheronUUID>( size_t( count ) );
+
+		job_system.Resize( bench.GetOptions( ).WorkerCount );
+
+		bench.Run( "Archetype/Entity/Create", count, count, 
+			[ & ]( ) { context = std::make_unique<acs::AcheronArchetypeContext>( ); },
+			[ & ]( ) { context->Create( count, entities ); }
+		);
+
+		bench.Run( "Archetype/Entity/Destroy", count, count,
+			[ & ]( ) { context = MakeArchetypeContext<CompA, CompB>( count, entities, &job_system ); },
+			[ & ]( ) { context->Destroy( entities, false ); }
+		);
+
+		bench.Run( "Archetype/Component/Append", count, count,
+			[ & ]( ) { context = MakeArchetypeContext<CompA>( count, entities, &job_system ); },
+			[ & ]( ) {
+				for ( const auto entity : entities )
+					context->Append( entity, CompB{ } );
+			}
+		);
+
+		bench.Run( "Archetype/Component/Remove", count, count,
+			[ & ]( ) { context = MakeArchetypeContext<CompA, CompB>( count, entities, &job_system ); },
+			[ & ]( ) {
+				for ( const auto entity : entities )
+					context->Remove<CompB>( entity );
+			}
+		);
+
+		context = MakeArchetypeContext<CompA, CompB, CompC, CompD>( count, entities, &job_system );
+
+		BenchArchetypeView<CompA>( bench, *context, count );
+		BenchArchetypeView<CompA, CompB>( bench, *context, count );
+		BenchArchetypeView<CompA, CompB, CompC>( bench, *context, count );
+		BenchArchetypeView<CompA, CompB, CompC, CompD>( bench, *context, count );
+
+		bench.Run( "Archetype/View/EachBatch<4>", count, count, nullptr, [ & ]( ) {
+			auto sum = 0.f;
+
+			acs::AcheronArchetypeView<CompA, CompB, CompC, CompD>( *context ).EachBatch( 
+				[ & ]( std::span<const acs::AcheronUUID> uuids, std::span<CompA> a, std::span<CompB> b, std::span<CompC> c, std::span<CompD> d ) {
+					for ( auto index = size_t( 0 ); index < uuids.size( ); index++ )
+						sum += a[ index ].Value + b[ index ].Value + c[ index ].Value + d[ index ].Value;
+				}
+			);
+
+			Sink = sum;
+		} );
+
+		bench.Run( "Archetype/View/ParallelEachBatch<2>", count, count, nullptr, [ & ]( ) {
+			acs::AcheronArchetypeView<CompA, const CompB>( *context ).ParallelEachBatch( 
+				[ ]( std::span<const acs::AcheronUUID> uuids, std::span<CompA> positions, std::span<const CompB> velocities ) {
+					for ( auto index = size_t( 0 ); index < uuids.size( ); index++ )
+						positions[ index ].Value += velocities[ index ].Value;
+				}, 
+				4096u 
+			);
+		} );
+	}
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	MAIN ===
+////////////////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char** argv ) {
+	auto options = acs_bench::BenchOptions{ };
+
+	if ( !acs_bench::ParseOptions( argc, argv, options ) )
+		return 1;
+
+	if ( options.IsHelp )
+		return 0;
+
+	if ( options.Mode == acs_bench::ACS_Bench_Scenario ) {
+		const auto result = acs_bench::RunScenario( options );
+
+		if ( !options.JsonPath.empty( ) ) {
+			auto stream = std::ofstream{ options.JsonPath };
+
+			if ( !stream ) {
+				std::cerr << "Can't open " << options.JsonPath << ".\n";
+
+				return 1;
+			}
+
+			acs_bench::WriteScenario( stream, options, result );
+		}
+
+		return 0;
+	}
+
+	auto bench = acs_bench::AcheronBench{ options };
+
+	for ( const auto count : options.EntityCounts ) {
+		acs_bench::BenchEntities( bench, count );
+		acs_bench::BenchComponents<acs_bench::CompA>( bench, count, "Sorted" );
+		acs_bench::BenchComponents<acs_bench::SparseComp>( bench, count, "Sparse" );
+		acs_bench::BenchComponents<acs_bench::FieldBodyComp>( bench, count, "Fields" );
+		acs_bench::BenchComponents<acs_bench::EmptyComp>( bench, count, "Empty" );
+		acs_bench::BenchViews( bench, count );
+		acs_bench::BenchIntegrate( bench, count );
+		acs_bench::BenchTags( bench, count );
+		acs_bench::BenchSweep( bench, count );
+		acs_bench::BenchSystems( bench, count );
+		acs_bench::BenchArchetypes( bench, count );
+	}
+
+	if ( !options.JsonPath.empty( ) ) {
+		auto stream = std::ofstream{ options.JsonPath };
+
+		if ( !stream ) {
+			std::cerr << "Can't open " << options.JsonPath << ".\n";
+
+			return 1;
+		}
+
+		bench.Write( stream );
+	}
+
+	return 0;
+}
@@ -0,0 +1,408 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "AcheronBench_Scenario.h"
+
+#include <cstdio>
+#include <random>
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	COMPONENTS ===
+////////////////////////////////////////////////////////////////////////////////////////////
+namespace acs_bench {
+
+	struct Position {
+
+		float X = 0.f;
+		float Y = 0.f;
+
+	};
+
+	struct Velocity {
+
+		float X = 1.f;
+		float Y = 1.f;
+
+	};
+
+	struct Health {
+
+		float Value = 50.f;
+		float Regen = 1.f;
+
+	};
+
+	struct AIState {
+
+		float TargetX = 0.f;
+		float TargetY = 0.f;
+		uint32_t Think = 0;
+
+	};
+
+};
+
+namespace acs {
+
+	template<>
+	struct AcheronComponentTraits<acs_bench::AIState> {
+
+		static constexpr AcheronStorageTypes Storage = ACS_Storage_Sparse;
+
+	};
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	SYSTEMS ===
+////////////////////////////////////////////////////////////////////////////////////////////
+namespace acs_bench {
+
+	// World half size, entities bounce on its borders.
+	static constexpr float WorldSize = 1000.f;
+
+	// Tick duration in seconds.
+	static constexpr float TickTime = 1.f / 60.f;
+
+	class AISystem final
+		: public acs::AcheronSystem<AIState, const Position, Velocity>
+	{
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext&,
+			void*,
+			std::tuple<acs::AcheronUUID, AIState*, const Position*, Velocity*>& components
+		) override {
+			auto [ entity, state, position, velocity ] = components;
+
+			if ( state->Think++ % 30 == 0 ) {
+				state->TargetX = -position->X;
+				state->TargetY = -position->Y;
+			}
+
+			velocity->X = ( state->TargetX - position->X ) * 0.1f;
+			velocity->Y = ( state->TargetY - position->Y ) * 0.1f;
+		};
+
+	};
+
+	class MovementSystem final
+		: public acs::AcheronSystem<Position, const Velocity>
+	{
+
+	public:
+		MovementSystem( )
+			: acs::AcheronSystem<Position, const Velocity>{ 4096 }
+		{ };
+
+	protected:
+		virtual void OnProcessBatch(
+			acs::AcheronContext&,
+			void*,
+			std::span<const acs::AcheronUUID> entities,
+			std::span<Position> positions,
+			std::span<const Velocity> velocities
+		) override {
+			for ( auto index = size_t( 0 ); index < entities.size( ); index++ ) {
+				positions[ index ].X += velocities[ index ].X * TickTime;
+				positions[ index ].Y += velocities[ index ].Y * TickTime;
+			}
+		};
+
+	};
+
+	class BoundsSystem final
+		: public acs::AcheronSystem<const Position, Velocity>
+	{
+
+	public:
+		BoundsSystem( )
+			: acs::AcheronSystem<const Position, Velocity>{ 4096 }
+		{ };
+
+	protected:
+		virtual void OnProcessBatch(
+			acs::AcheronContext&,
+			void*,
+			std::span<const acs::AcheronUUID> entities,
+			std::span<const Position> positions,
+			std::span<Velocity> velocities
+		) override {
+			for ( auto index = size_t( 0 ); index < entities.size( ); index++ ) {
+				if ( std::abs( positions[ index ].X ) > WorldSize )
+					velocities[ index ].X = -velocities[ index ].X;
+
+				if ( std::abs( positions[ index ].Y ) > WorldSize )
+					velocities[ index ].Y = -velocities[ index ].Y;
+			}
+		};
+
+	};
+
+	class HealthSystem final
+		: public acs::AcheronSystem<Health>
+	{
+
+	public:
+		HealthSystem( )
+			: acs::AcheronSystem<Health>{ 4096 }
+		{ };
+
+	protected:
+		virtual void OnProcessBatch(
+			acs::AcheronContext&,
+			void*,
+			std::span<const acs::AcheronUUID>,
+			std::span<Health> healths
+		) override {
+			for ( auto& health : healths )
+				health.Value = std::min( health.Value + health.Regen * TickTime, 100.f );
+		};
+
+	};
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	INTERNAL ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	class ScenarioWorld final {
+
+	private:
+		const BenchOptions& m_options;
+		acs::AcheronComponentSystem m_context;
+		std::vector<acs::AcheronUUID> m_alive;
+		std::vector<acs::AcheronUUID> m_spawned;
+		std::mt19937 m_random;
+
+	public:
+		ScenarioWorld( const BenchOptions& options )
+			: m_options{ options },
+			m_context{ },
+			m_alive{ },
+			m_spawned{ },
+			m_random{ 42 }
+		{
+			m_context.ResizeWorkerPool( options.WorkerCount );
+			m_context.Register<AISystem>( true );
+			m_context.Register<MovementSystem>( true );
+			m_context.Register<BoundsSystem>( true );
+			m_context.Register<HealthSystem>( true );
+			m_context.RunBefore<AISystem, MovementSystem>( );
+			m_context.RunBefore<MovementSystem, BoundsSystem>( );
+
+			Spawn( options.EntityCount );
+		};
+
+		void Churn( const uint32_t count ) {
+			auto index = std::uniform_int_distribution<size_t>{ };
+
+			for ( auto despawn = uint32_t( 0 ); despawn < count && !m_alive.empty( ); despawn++ ) {
+				const auto slot = index( m_random ) % m_alive.size( );
+
+				m_context.Destroy( m_alive[ slot ], true );
+
+				m_alive[ slot ] = m_alive.back( );
+				m_alive.pop_back( );
+			}
+
+			Spawn( count );
+		};
+
+		void Sweep( ) {
+			m_context.Sweep( );
+		};
+
+		void Process( ) {
+			m_context.Process( nullptr, TickTime );
+		};
+
+		uint32_t GetCount( ) const {
+			return m_context.GetEntityCount( );
+		};
+
+	private:
+		void Spawn( const uint32_t count ) {
+			if ( count == 0 )
+				return;
+
+			auto position = std::uniform_real_distribution<float>{ -WorldSize, WorldSize };
+			auto chance	  = std::uniform_real_distribution<float>{ 0.f, 1.f };
+			auto positions	= std::vector<Position>( size_t( count ) );
+			auto velocities = std::vector<Velocity>( size_t( count ) );
+			auto healthy	= std::vector<acs::AcheronUUID>{ };
+			auto thinking	= std::vector<acs::AcheronUUID>{ };
+
+			m_spawned.resize( size_t( count ) );
+			m_context.Create( count, m_spawned );
+
+			for ( auto index = size_t( 0 ); index < m_spawned.size( ); index++ ) {
+				positions[ index ] = Position{ position( m_random ), position( m_random ) };
+
+				if ( chance( m_random ) < m_options.HealthRate )
+					healthy.emplace_back( m_spawned[ index ] );
+
+				if ( chance( m_random ) < m_options.AIRate )
+					thinking.emplace_back( m_spawned[ index ] );
+			}
+
+			auto healths = std::vector<Health>( healthy.size( ) );
+			auto states	 = std::vector<AIState>( thinking.size( ) );
+
+			m_context.AppendRange<Position>( m_spawned, positions );
+			m_context.AppendRange<Velocity>( m_spawned, velocities );
+			m_context.AppendRange<Health>( healthy, healths );
+			m_context.AppendRange<AIState>( thinking, states );
+
+			m_alive.insert( m_alive.end( ), m_spawned.begin( ), m_spawned.end( ) );
+		};
+
+	};
+
+	static ScenarioStats GetStats( std::vector<double> samples ) {
+		auto percentile = [ & ]( const double rank ) -> double {
+			const auto index = std::min( size_t( rank * double( samples.size( ) ) ), samples.size( ) - 1 );
+
+			return samples[ index ];
+		};
+
+		std::sort( samples.begin( ), samples.end( ) );
+
+		return { percentile( 0.50 ), percentile( 0.95 ), percentile( 0.99 ), samples.back( ) };
+	}
+
+	static void WriteStats( std::ostream& stream, const char* name, const ScenarioStats& stats ) {
+		stream << "\t\"" << name << "\": { \"p50\": " << stats.P50
+			<< ", \"p95\": " << stats.P95
+			<< ", \"p99\": " << stats.P99
+			<< ", \"max\": " << stats.Max << " },\n";
+	}
+
+	static void PrintStats( const char* name, const ScenarioStats& stats ) {
+		std::printf( "%-10s p50 %8.3f ms  p95 %8.3f ms  p99 %8.3f ms  max %8.3f ms\n", name, stats.P50, stats.P95, stats.P99, stats.Max );
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	ScenarioResult RunScenario( const BenchOptions& options ) {
+		using Milliseconds = std::chrono::duration<double, std::milli>;
+
+		const auto churn_count = uint32_t( double( options.EntityCount ) * double( options.ChurnRate ) );
+		auto tick_times	   = std::vector<double>{ };
+		auto churn_times   = std::vector<double>{ };
+		auto sweep_times   = std::vector<double>{ };
+		auto process_times = std::vector<double>{ };
+		auto result = ScenarioResult{ };
+
+		ResetPeakBytes( );
+
+		{
+			auto world = ScenarioWorld{ options };
+
+			// Warm-up ticks build the view caches and the system schedule.
+			for ( auto tick = uint32_t( 0 ); tick < options.WarmupCount; tick++ ) {
+				world.Churn( churn_count );
+				world.Sweep( );
+				world.Process( );
+			}
+
+			for ( auto tick = uint32_t( 0 ); tick < options.TickCount; tick++ ) {
+				const auto start = std::chrono::steady_clock::now( );
+
+				world.Churn( churn_count );
+
+				const auto churn_stop = std::chrono::steady_clock::now( );
+
+				world.Sweep( );
+
+				const auto sweep_stop = std::chrono::steady_clock::now( );
+
+				world.Process( );
+
+				const auto stop = std::chrono::steady_clock::now( );
+
+				churn_times.emplace_back( Milliseconds( churn_stop - start ).count( ) );
+				sweep_times.emplace_back( Milliseconds( sweep_stop - churn_stop ).count( ) );
+				process_times.emplace_back( Milliseconds( stop - sweep_stop ).count( ) );
+				tick_times.emplace_back( Milliseconds( stop - start ).count( ) );
+			}
+
+			result.FinalBytes		= GetLiveBytes( );
+			result.FinalEntityCount = world.GetCount( );
+		}
+
+		result.TickTimes	= GetStats( tick_times );
+		result.ChurnTimes	= GetStats( churn_times );
+		result.SweepTimes	= GetStats( sweep_times );
+		result.ProcessTimes = GetStats( process_times );
+		result.PeakBytes	= GetPeakBytes( );
+
+		std::printf( 
+			"Scenario : %u entities, %u ticks, %u spawned and despawned per tick, %u workers\n",
+			options.EntityCount, options.TickCount, churn_count, options.WorkerCount
+		);
+
+		PrintStats( "Tick", result.TickTimes );
+		PrintStats( "Churn", result.ChurnTimes );
+		PrintStats( "Sweep", result.SweepTimes );
+		PrintStats( "Process", result.ProcessTimes );
+
+		std::printf( 
+			"Memory   peak %.2f MiB  final %.2f MiB\n",
+			double( result.PeakBytes ) / ( 1024.0 * 1024.0 ), double( result.FinalBytes ) / ( 1024.0 * 1024.0 )
+		);
+
+		return result;
+	}
+
+	void WriteScenario( std::ostream& stream, const BenchOptions& options, const ScenarioResult& result ) {
+		stream << "{\n\t\"context\": { \"version\": \"" << ACS_VERSION << "\""
+			<< ", \"warmup\": " << options.WarmupCount
+			<< ", \"workers\": " << options.WorkerCount
+			<< " },\n\t\"scenario\": { \"entities\": " << options.EntityCount
+			<< ", \"ticks\": " << options.TickCount
+			<< ", \"churn\": " << options.ChurnRate
+			<< ", \"health\": " << options.HealthRate
+			<< ", \"ai\": " << options.AIRate
+			<< ", \"final_entities\": " << result.FinalEntityCount
+			<< " },\n";
+
+		WriteStats( stream, "tick_ms", result.TickTimes );
+		WriteStats( stream, "churn_ms", result.ChurnTimes );
+		WriteStats( stream, "sweep_ms", result.SweepTimes );
+		WriteStats( stream, "process_ms", result.ProcessTimes );
+
+		stream << "\t\"peak_heap_bytes\": " << result.PeakBytes
+			<< ",\n\t\"final_heap_bytes\": " << result.FinalBytes << "\n}\n";
+	}
+
+};
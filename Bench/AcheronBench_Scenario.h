@@ -30,35 +30,52 @@
  *
  **/
 
-#pragma once 
+#pragma once
 
-#include "AcheronComponentStorage.h"
+#include "AcheronBench_Utils.h"
 
-namespace acs {
+namespace acs_bench {
 
-    struct AcheronComponentEntry final {
+	struct ScenarioStats {
 
-        std::function<void( const uint32_t )> Resize;
-        std::function<void( const bool )> Clear;
-        std::function<void( const std::vector<AcheronUUID>& )> Sweep;
+		double P50;
+		double P95;
+		double P99;
+		double Max;
 
-        /**
-         * Constructor
-         **/
-        AcheronComponentEntry( );
+	};
 
-        /**
-         * Constructor
-         * @param resize : Resize callback for the component storage entry.
-         * @param clear : Clear callback for the component storage entry.
-         * @param sweep : Sweep callback for the component storage entry.
-         **/
-        AcheronComponentEntry(
-            std::function<void( const uint32_t )> resize,
-            std::function<void( const bool )> clear,
-            std::function<void( const std::vector<AcheronUUID>& )> sweep
-        );
+	struct ScenarioResult {
 
-    };
+		ScenarioStats TickTimes;
+		ScenarioStats ChurnTimes;
+		ScenarioStats SweepTimes;
+		ScenarioStats ProcessTimes;
+		uint64_t PeakBytes;
+		uint64_t FinalBytes;
+		uint32_t FinalEntityCount;
+
+	};
+
+	/**
+	 * RunScenario function
+	 * @note : Simulate a server tick loop : each tick despawns and spawns
+	 *		   a fraction of the world, sweeps the despawned entities and
+	 *		   process every system through AcheronComponentSystem. Times
+	 *		   are in milliseconds, memory is the global operator new 
+	 *		   live bytes high-water mark during the run.
+	 * @param options : Bench options.
+	 * @return Scenario result.
+	 **/
+	ScenarioResult RunScenario( const BenchOptions& options );
+
+	/**
+	 * WriteScenario function
+	 * @note : Write a scenario result as JSON.
+	 * @param stream : Reference to the output stream.
+	 * @param options : Bench options.
+	 * @param result : Scenario result.
+	 **/
+	void WriteScenario( std::ostream& stream, const BenchOptions& options, const ScenarioResult& result );
 
 };
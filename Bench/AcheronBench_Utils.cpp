@@ -0,0 +1,332 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "AcheronBench_Utils.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <new>
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	ALLOCATION TRACKING ===
+////////////////////////////////////////////////////////////////////////////////////////////
+// Each allocation is prefixed by its size so live bytes can be tracked.
+static constexpr std::size_t AllocationHeader = alignof( std::max_align_t );
+
+static std::atomic<uint64_t> AllocationCount{ 0 };
+static std::atomic<uint64_t> AllocatedBytes{ 0 };
+static std::atomic<uint64_t> LiveBytes{ 0 };
+static std::atomic<uint64_t> PeakBytes{ 0 };
+
+void* operator new( std::size_t size ) {
+	auto* memory = static_cast<std::byte*>( std::malloc( size + AllocationHeader ) );
+
+	if ( memory == nullptr )
+		throw std::bad_alloc{ };
+
+	*reinterpret_cast<std::size_t*>( memory ) = size;
+
+	const auto live_bytes = LiveBytes.fetch_add( uint64_t( size ), std::memory_order_relaxed ) + uint64_t( size );
+	auto peak_bytes = PeakBytes.load( std::memory_order_relaxed );
+
+	while ( peak_bytes < live_bytes && !PeakBytes.compare_exchange_weak( peak_bytes, live_bytes, std::memory_order_relaxed ) );
+
+	AllocationCount.fetch_add( 1, std::memory_order_relaxed );
+	AllocatedBytes.fetch_add( uint64_t( size ), std::memory_order_relaxed );
+
+	return memory + AllocationHeader;
+}
+
+void operator delete( void* memory ) noexcept {
+	if ( memory == nullptr )
+		return;
+
+	auto* allocation = static_cast<std::byte*>( memory ) - AllocationHeader;
+
+	LiveBytes.fetch_sub( uint64_t( *reinterpret_cast<std::size_t*>( allocation ) ), std::memory_order_relaxed );
+
+	std::free( allocation );
+}
+
+void operator delete( void* memory, std::size_t ) noexcept {
+	operator delete( memory );
+}
+
+namespace acs_bench {
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	AcheronBench::AcheronBench( const BenchOptions& options )
+		: m_options{ options },
+		m_results{ }
+	{
+	}
+
+	void AcheronBench::Run(
+		const std::string& name,
+		const uint32_t entity_count,
+		const uint64_t operation_count,
+		std::function<void( )> setup,
+		std::function<void( )> executor
+	) {
+		if ( !GetIsSelected( name ) )
+			return;
+
+		const auto divider = double( std::max( operation_count, uint64_t( 1 ) ) );
+		auto costs		 = std::vector<double>{ };
+		auto allocations = uint64_t( 0 );
+		auto bytes		 = uint64_t( 0 );
+
+		costs.reserve( m_options.RepeatCount );
+
+		for ( auto repeat = uint32_t( 0 ); repeat < m_options.WarmupCount + m_options.RepeatCount; repeat++ ) {
+			if ( setup )
+				setup( );
+
+			const auto allocation_start = GetAllocationCount( );
+			const auto bytes_start		= GetAllocatedBytes( );
+			const auto start			= std::chrono::steady_clock::now( );
+
+			executor( );
+
+			const auto stop = std::chrono::steady_clock::now( );
+
+			if ( repeat < m_options.WarmupCount )
+				continue;
+
+			costs.emplace_back( double( std::chrono::duration_cast<std::chrono::nanoseconds>( stop - start ).count( ) ) / divider );
+
+			allocations += GetAllocationCount( ) - allocation_start;
+			bytes		+= GetAllocatedBytes( ) - bytes_start;
+		}
+
+		auto result = BenchResult{ name, entity_count, operation_count, m_options.RepeatCount, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+		std::sort( costs.begin( ), costs.end( ) );
+
+		result.MinCost		  = costs.front( );
+		result.MedianCost	  = costs[ costs.size( ) / 2 ];
+		result.MeanCost		  = std::accumulate( costs.begin( ), costs.end( ), 0.0 ) / double( costs.size( ) );
+		result.Allocations	  = double( allocations ) / ( divider * double( m_options.RepeatCount ) );
+		result.AllocatedBytes = double( bytes ) / ( divider * double( m_options.RepeatCount ) );
+
+		std::printf( 
+			"%-32s %10u entities %12.2f ns/op ( min %.2f ) %10.4f allocs/op %12.2f bytes/op\n",
+			name.c_str( ), entity_count, result.MedianCost, result.MinCost, result.Allocations, result.AllocatedBytes
+		);
+
+		m_results.emplace_back( std::move( result ) );
+	}
+
+	void AcheronBench::Write( std::ostream& stream ) const {
+		stream << "{\n\t\"context\": { \"version\": \"" << ACS_VERSION << "\""
+			<< ", \"warmup\": " << m_options.WarmupCount
+			<< ", \"repetitions\": " << m_options.RepeatCount
+			<< ", \"workers\": " << m_options.WorkerCount
+			<< " },\n\t\"benchmarks\": [";
+
+		for ( auto index = size_t( 0 ); index < m_results.size( ); index++ ) {
+			const auto& result = m_results[ index ];
+
+			stream << ( index > 0 ? ",\n" : "\n" )
+				<< "\t\t{ \"name\": \"" << result.Name << "\""
+				<< ", \"entities\": " << result.EntityCount
+				<< ", \"operations\": " << result.OperationCount
+				<< ", \"repetitions\": " << result.RepeatCount
+				<< ", \"ns_per_op\": " << result.MedianCost
+				<< ", \"min_ns_per_op\": " << result.MinCost
+				<< ", \"mean_ns_per_op\": " << result.MeanCost
+				<< ", \"allocs_per_op\": " << result.Allocations
+				<< ", \"bytes_per_op\": " << result.AllocatedBytes
+				<< " }";
+		}
+
+		stream << "\n\t]\n}\n";
+	}
+
+	static void WriteUsage( std::ostream& stream ) {
+		stream << "Usage : Acheron-Bench [options]\n"
+			<< "  --mode <micro|scenario>  Bench mode, micro by default.\n"
+			<< "  --min <count>            Minimum entity count, 1000 by default.\n"
+			<< "  --max <count>            Maximum entity count, 10000000 by default.\n"
+			<< "  --warmup <count>         Warmup repetition count, 1 by default.\n"
+			<< "  --reps <count>           Measured repetition count, 5 by default.\n"
+			<< "  --workers <count>        Job system worker count.\n"
+			<< "  --filter <text>          Only run benches whose name contains text.\n"
+			<< "  --json <path>            Write the results as JSON to path.\n"
+			<< "  --entities <count>       Scenario world size, 100000 by default.\n"
+			<< "  --ticks <count>          Scenario tick count, 600 by default.\n"
+			<< "  --churn <rate>           Scenario despawn and spawn rate, 0.01 by default.\n"
+			<< "  --health <rate>          Scenario health owner rate, 0.5 by default.\n"
+			<< "  --ai <rate>              Scenario AI owner rate, 0.1 by default.\n"
+			<< "  --help, -h               Print this help.\n";
+	}
+
+	bool ParseOptions( const int argc, char** argv, BenchOptions& options ) {
+		auto min_count = uint64_t( 1000 );
+		auto max_count = uint64_t( 10000000 );
+
+		options.Mode		= ACS_Bench_Micro;
+		options.WarmupCount = 1;
+		options.RepeatCount = 5;
+		options.WorkerCount = std::max( std::thread::hardware_concurrency( ), 2u ) - 1;
+		options.EntityCount = 100000;
+		options.TickCount	= 600;
+		options.ChurnRate	= 0.01f;
+		options.HealthRate	= 0.5f;
+		options.AIRate		= 0.1f;
+		options.IsHelp		= false;
+
+		for ( auto index = 1; index < argc; index++ ) {
+			const auto argument = std::string_view{ argv[ index ] };
+			const auto* value	= ( index + 1 < argc ) ? argv[ index + 1 ] : nullptr;
+
+			if ( argument == "--help" || argument == "-h" ) {
+				WriteUsage( std::cout );
+
+				options.IsHelp = true;
+
+				return true;
+			}
+
+			if ( value == nullptr ) {
+				std::cerr << "Missing value for " << argument << ".\n";
+
+				WriteUsage( std::cerr );
+
+				return false;
+			}
+
+			if ( argument == "--mode" ) {
+				if ( std::string_view{ value } == "micro" )
+					options.Mode = ACS_Bench_Micro;
+				else if ( std::string_view{ value } == "scenario" )
+					options.Mode = ACS_Bench_Scenario;
+				else {
+					std::cerr << "Unknown mode " << value << ".\n";
+
+					return false;
+				}
+			} else if ( argument == "--min" )
+				min_count = std::strtoull( value, nullptr, 10 );
+			else if ( argument == "--max" )
+				max_count = std::strtoull( value, nullptr, 10 );
+			else if ( argument == "--warmup" )
+				options.WarmupCount = uint32_t( std::strtoul( value, nullptr, 10 ) );
+			else if ( argument == "--reps" )
+				options.RepeatCount = uint32_t( std::strtoul( value, nullptr, 10 ) );
+			else if ( argument == "--workers" )
+				options.WorkerCount = uint32_t( std::strtoul( value, nullptr, 10 ) );
+			else if ( argument == "--filter" )
+				options.Filter = value;
+			else if ( argument == "--json" )
+				options.JsonPath = value;
+			else if ( argument == "--entities" )
+				options.EntityCount = uint32_t( std::strtoul( value, nullptr, 10 ) );
+			else if ( argument == "--ticks" )
+				options.TickCount = uint32_t( std::strtoul( value, nullptr, 10 ) );
+			else if ( argument == "--churn" )
+				options.ChurnRate = std::strtof( value, nullptr );
+			else if ( argument == "--health" )
+				options.HealthRate = std::strtof( value, nullptr );
+			else if ( argument == "--ai" )
+				options.AIRate = std::strtof( value, nullptr );
+			else {
+				std::cerr << "Unknown option " << argument << ".\n";
+
+				WriteUsage( std::cerr );
+
+				return false;
+			}
+
+			index += 1;
+		}
+
+		if ( min_count == 0 || max_count < min_count || max_count > UINT32_MAX || options.RepeatCount == 0 ) {
+			std::cerr << "Invalid entity count bounds or repetition count.\n";
+
+			return false;
+		}
+
+		const auto is_rate = []( const float rate ) -> bool {
+			return rate >= 0.f && rate <= 1.f;
+		};
+
+		if ( options.EntityCount == 0 || options.TickCount == 0 || !is_rate( options.ChurnRate ) || !is_rate( options.HealthRate ) || !is_rate( options.AIRate ) ) {
+			std::cerr << "Invalid scenario entity count, tick count or rates.\n";
+
+			return false;
+		}
+
+		for ( auto count = min_count; count <= max_count; count *= 10 )
+			options.EntityCounts.emplace_back( uint32_t( count ) );
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////
+	//		===	PUBLIC GET ===
+	////////////////////////////////////////////////////////////////////////////////////////////
+	bool AcheronBench::GetIsSelected( const std::string& name ) const {
+		return m_options.Filter.empty( ) || name.find( m_options.Filter ) != std::string::npos;
+	}
+
+	const BenchOptions& AcheronBench::GetOptions( ) const {
+		return m_options;
+	}
+
+	const std::vector<BenchResult>& AcheronBench::GetResults( ) const {
+		return m_results;
+	}
+
+	uint64_t GetAllocationCount( ) {
+		return AllocationCount.load( std::memory_order_relaxed );
+	}
+
+	uint64_t GetAllocatedBytes( ) {
+		return AllocatedBytes.load( std::memory_order_relaxed );
+	}
+
+	uint64_t GetLiveBytes( ) {
+		return LiveBytes.load( std::memory_order_relaxed );
+	}
+
+	uint64_t GetPeakBytes( ) {
+		return PeakBytes.load( std::memory_order_relaxed );
+	}
+
+	void ResetPeakBytes( ) {
+		PeakBytes.store( GetLiveBytes( ), std::memory_order_relaxed );
+	}
+
+};
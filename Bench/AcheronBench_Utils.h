@@ -0,0 +1,210 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include <Acheron.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace acs_bench {
+
+	enum BenchModes : uint32_t {
+
+		ACS_Bench_Micro = 0,
+		ACS_Bench_Scenario
+
+	};
+
+	struct BenchOptions {
+
+		BenchModes Mode;
+		std::vector<uint32_t> EntityCounts;
+		uint32_t WarmupCount;
+		uint32_t RepeatCount;
+		uint32_t WorkerCount;
+		std::string Filter;
+		std::string JsonPath;
+
+		// Scenario mode options.
+		uint32_t EntityCount;
+		uint32_t TickCount;
+		float ChurnRate;
+		float HealthRate;
+		float AIRate;
+
+		// Set when --help was given, nothing is run.
+		bool IsHelp;
+
+	};
+
+	struct BenchResult {
+
+		std::string Name;
+		uint32_t EntityCount;
+		uint64_t OperationCount;
+		uint32_t RepeatCount;
+		double MinCost;
+		double MedianCost;
+		double MeanCost;
+		double Allocations;
+		double AllocatedBytes;
+
+	};
+
+	class AcheronBench final {
+
+	private:
+		BenchOptions m_options;
+		std::vector<BenchResult> m_results;
+
+	public:
+		/**
+		 * Constructor
+		 * @param options : Bench options.
+		 **/
+		AcheronBench( const BenchOptions& options );
+
+		/**
+		 * Destructor
+		 **/
+		~AcheronBench( ) = default;
+
+		/**
+		 * Run method
+		 * @note : Run a bench for warm-up then measured repetitions, setup
+		 *		   runs before each repetition and isn't measured. Costs and
+		 *		   allocations are reported per operation. Benches not 
+		 *		   matching the option filter are skipped.
+		 * @param name : Bench name.
+		 * @param entity_count : Bench entity count.
+		 * @param operation_count : Operation count executed by the executor.
+		 * @param setup : Function preparing a repetition.
+		 * @param executor : Benching function.
+		 **/
+		void Run(
+			const std::string& name,
+			const uint32_t entity_count,
+			const uint64_t operation_count,
+			std::function<void( )> setup,
+			std::function<void( )> executor
+		);
+
+		/**
+		 * Write const method
+		 * @note : Write bench results as JSON.
+		 * @param stream : Reference to the output stream.
+		 **/
+		void Write( std::ostream& stream ) const;
+
+	public:
+		/**
+		 * GetIsSelected const function
+		 * @note : Get if a bench match the option filter.
+		 * @param name : Bench name.
+		 * @return True when the bench must run.
+		 **/
+		bool GetIsSelected( const std::string& name ) const;
+
+		/**
+		 * GetOptions const function
+		 * @note : Get bench options.
+		 * @return Constant reference to bench options.
+		 **/
+		const BenchOptions& GetOptions( ) const;
+
+		/**
+		 * GetResults const function
+		 * @note : Get bench results.
+		 * @return Constant reference to bench results.
+		 **/
+		const std::vector<BenchResult>& GetResults( ) const;
+
+	};
+
+	/**
+	 * ParseOptions function
+	 * @note : Parse command line options : --mode micro or scenario,
+	 *		   --min and --max entity count bounds stepping by powers of 
+	 *		   ten from 1e3 to 1e7 by default, --warmup and --reps 
+	 *		   repetition counts, --workers job system worker count, 
+	 *		   --filter bench name substring and --json output path. 
+	 *		   Scenario mode use --entities world size, --ticks tick 
+	 *		   count, --churn fraction of the world despawned and spawned
+	 *		   each tick, --health and --ai fraction of entities owning 
+	 *		   these components. --help or -h print the option list.
+	 * @param argc : Argument count.
+	 * @param argv : Argument values.
+	 * @param options : Reference to parsed options.
+	 * @return False when the arguments are invalid.
+	 **/
+	bool ParseOptions( const int argc, char** argv, BenchOptions& options );
+
+	/**
+	 * GetAllocationCount function
+	 * @note : Get global operator new call count since program start.
+	 * @return Allocation count as uint64_t.
+	 **/
+	uint64_t GetAllocationCount( );
+
+	/**
+	 * GetAllocatedBytes function
+	 * @note : Get bytes requested from global operator new since program 
+	 *		   start.
+	 * @return Allocated bytes as uint64_t.
+	 **/
+	uint64_t GetAllocatedBytes( );
+
+	/**
+	 * GetLiveBytes function
+	 * @note : Get bytes allocated with global operator new and not freed.
+	 * @return Live bytes as uint64_t.
+	 **/
+	uint64_t GetLiveBytes( );
+
+	/**
+	 * GetPeakBytes function
+	 * @note : Get live bytes high-water mark since program start or the 
+	 *		   last ResetPeakBytes call.
+	 * @return Peak live bytes as uint64_t.
+	 **/
+	uint64_t GetPeakBytes( );
+
+	/**
+	 * ResetPeakBytes function
+	 * @note : Reset the live bytes high-water mark to current live bytes.
+	 **/
+	void ResetPeakBytes( );
+
+};
@@ -28,6 +28,7 @@ project "Acheron"
 	-- LINUX
 	filter "system:linux"
 		systemversion "latest"
+		cppdialect "C++20"
 		buildoptions { "-fPIC" }
 
 		--- LINUX SPECIFIC DEFINES
@@ -50,7 +51,7 @@ project "Acheron"
 		symbols "On"
 
 		--- DEFINES
-		defines { "DEBUG" }
+		defines { "DEBUG", "ACS_ENABLE_PROFILING" }
 
 	filter "configurations:Release"
 		runtime "Release"
@@ -58,7 +59,7 @@ project "Acheron"
 		symbols "On"
 
 		--- DEFINES
-		defines { "RELEASE" }
+		defines { "RELEASE", "ACS_ENABLE_PROFILING" }
 
 	filter "configurations:Dist"
 		runtime "Release"
@@ -0,0 +1,59 @@
+project "Acheron-Bench"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+	staticruntime "off"
+
+	--- OUTPUT
+	location "%{OutputDirs.Solution}"
+	targetdir "%{OutputDirs.Bin}/%{cfg.buildcfg}/"
+	debugdir "%{OutputDirs.Bin}/%{cfg.buildcfg}/"
+	objdir "%{OutputDirs.BinInt}/%{prj.name}-%{cfg.buildcfg}"
+
+	--- GLOBAL INCLUDES
+	includedirs "%{IncludeDirs.Acheron}"
+
+	externalincludedirs "%{IncludeDirs.Acheron}"
+
+	--- GLOBAL LINKS
+	links "Acheron"
+
+	--- SOURCES FILES
+	files {
+		"%{IncludeDirs.Bench}**.h",
+		"%{IncludeDirs.Bench}**.cpp"
+	}
+
+	--- CONFIGURATION
+	filter "configurations:Debug"
+		defines { "DEBUG", "ACS_ENABLE_PROFILING" }
+		runtime "Debug"
+		symbols "On"
+
+	filter "configurations:Release"
+		defines { "RELEASE", "ACS_ENABLE_PROFILING" }
+		runtime "Release"
+		optimize "On"
+		symbols "On"
+
+	filter "configurations:Dist"
+		defines { "DIST" }
+		runtime "Release"
+		optimize "On"
+		symbols "Off"
+
+	--- WINDOWS
+	filter "system:windows"
+		systemversion "latest"
+		
+		--- DEFINES
+		defines { 
+			"WINDOWS",
+			"_CRT_SECURE_NO_WARNINGS" 
+		}
+
+	--- LINUX
+	filter "system:linux"
+		systemversion "latest"
+		defines { "LINUX" }
+		links { "pthread" }
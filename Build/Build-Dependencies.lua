@@ -13,3 +13,4 @@ IncludeDirs = { }
 
 IncludeDirs[ 'Acheron' ] = '%{wks.location}Acheron/'
 IncludeDirs[ 'Test' ] = '%{wks.location}Test/'
+IncludeDirs[ 'Bench' ] = '%{wks.location}Bench/'
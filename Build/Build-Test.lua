@@ -18,12 +18,12 @@ project "Acheron-Test"
 
 	--- CONFIGURATION
 	filter "configurations:Debug"
-		defines { "DEBUG" }
+		defines { "DEBUG", "ACS_ENABLE_PROFILING" }
 		runtime "Debug"
 		symbols "On"
 
 	filter "configurations:Release"
-		defines { "RELEASE" }
+		defines { "RELEASE", "ACS_ENABLE_PROFILING" }
 		runtime "Release"
 		optimize "On"
 		symbols "On"
@@ -55,7 +55,9 @@ project "Acheron-Test"
 	--- LINUX
 	filter "system:linux"
 		systemversion "latest"
+		cppdialect "C++20"
 		defines { "LINUX" }
+		links { "pthread" }
 
 		--- SOURCES FILESs
 		files {
@@ -29,3 +29,4 @@ workspace 'Acheron Library'
     --- PROJECT
     include 'Build-Acheron.lua'
     include 'Build-Test.lua'
+    include 'Build-Bench.lua'
@@ -0,0 +1,182 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "AcheronTest_Utils.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	TEST ===
+////////////////////////////////////////////////////////////////////////////////////////////
+namespace UnitTest {
+
+	struct ArchetypeValue {
+
+		uint32_t Value = 0;
+
+	};
+
+	struct ArchetypeName {
+
+		std::string Name;
+
+	};
+
+	TEST_CLASS( Archetypes ) {
+
+	public:
+		TEST_METHOD( AppendRemove ) {
+			auto acheron  = acs::AcheronArchetypeContext{ };
+			auto entity_1 = acheron.Create( );
+			auto entity_2 = acheron.Create( );
+
+			acheron.Append( entity_1, ArchetypeValue{ 1 } );
+			acheron.Append( entity_2, ArchetypeValue{ 2 } );
+			acheron.Append( entity_2, ArchetypeName{ "entity_2" } );
+			acheron.Append( entity_2, ArchetypeValue{ 3 } );
+
+			Assert::AreEqual( acheron.GetComponent<ArchetypeValue>( entity_1 )->Value, uint32_t( 1 ) );
+			Assert::AreEqual( acheron.GetComponent<ArchetypeValue>( entity_2 )->Value, uint32_t( 2 ) );
+			Assert::IsTrue( acheron.GetComponent<ArchetypeName>( entity_2 )->Name == "entity_2" );
+			Assert::IsNull( acheron.GetComponent<ArchetypeName>( entity_1 ) );
+
+			acheron.Remove<ArchetypeValue>( entity_2 );
+
+			Assert::IsNull( acheron.GetComponent<ArchetypeValue>( entity_2 ) );
+			Assert::IsTrue( acheron.GetComponent<ArchetypeName>( entity_2 )->Name == "entity_2" );
+			Assert::AreEqual( acheron.GetComponent<ArchetypeValue>( entity_1 )->Value, uint32_t( 1 ) );
+			Assert::AreEqual( acheron.GetArchetypes( ).size( ), size_t( 4 ) );
+		};
+
+		TEST_METHOD( View ) {
+			auto acheron  = acs::AcheronArchetypeContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 3000 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index++ ) {
+				acheron.Append( entities[ index ], ArchetypeValue{ index } );
+
+				if ( index % 3 == 0 )
+					acheron.Append( entities[ index ], ArchetypeName{ std::to_string( index ) } );
+			}
+
+			auto view  = acs::AcheronArchetypeView<ArchetypeValue>{ acheron };
+			auto count = uint32_t( 0 );
+			auto sum   = uint64_t( 0 );
+
+			for ( auto [ entity, value ] : view ) {
+				count += 1;
+				sum   += value->Value;
+			}
+
+			Assert::AreEqual( count, uint32_t( entities.size( ) ) );
+			Assert::AreEqual( view.GetCount( ), count );
+			Assert::AreEqual( sum, uint64_t( 2999 * 3000 / 2 ) );
+
+			auto batches = uint32_t( 0 );
+			auto named   = uint32_t( 0 );
+
+			acs::AcheronArchetypeView<const ArchetypeValue, ArchetypeName>{ acheron }.EachBatch( 
+				[ & ]( std::span<const acs::AcheronUUID> uuids, std::span<const ArchetypeValue> values, std::span<ArchetypeName> names ) {
+					batches += 1;
+
+					for ( auto index = size_t( 0 ); index < uuids.size( ); index++ ) {
+						if ( names[ index ].Name == std::to_string( values[ index ].Value ) )
+							named += 1;
+					}
+				}
+			);
+
+			Assert::AreEqual( named, uint32_t( 1000 ) );
+			Assert::IsTrue( batches > 1 );
+		};
+
+		TEST_METHOD( Destroy ) {
+			auto acheron  = acs::AcheronArchetypeContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 4 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index++ )
+				acheron.Append( entities[ index ], ArchetypeName{ std::to_string( index ) } );
+
+			acheron.Destroy( entities[ 1 ], false );
+
+			Assert::IsFalse( acheron.GetIsAlive( entities[ 1 ] ) );
+			Assert::IsNull( acheron.GetComponent<ArchetypeName>( entities[ 1 ] ) );
+			Assert::IsTrue( acheron.GetComponent<ArchetypeName>( entities[ 3 ] )->Name == "3" );
+
+			acheron.Destroy( entities[ 0 ], true );
+
+			auto entity = acheron.Create( );
+
+			acheron.Append( entity, ArchetypeName{ "new" } );
+			acheron.Sweep( );
+
+			Assert::IsTrue( acheron.GetComponent<ArchetypeName>( entity )->Name == "new" );
+			Assert::IsTrue( acheron.GetComponent<ArchetypeName>( entities[ 2 ] )->Name == "2" );
+			Assert::AreEqual( acs::AcheronArchetypeView<ArchetypeName>{ acheron }.GetCount( ), uint32_t( 3 ) );
+		};
+
+		TEST_METHOD( ParallelEachBatch ) {
+			auto job_system = acs::AcheronJobSystem{ };
+			auto acheron    = acs::AcheronArchetypeContext{ };
+			auto entities   = std::vector<acs::AcheronUUID>( 10000 );
+
+			job_system.Resize( 4 );
+			acheron.SetJobSystem( &job_system );
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities )
+				acheron.Append( entity, ArchetypeValue{ 1 } );
+
+			auto view = acs::AcheronArchetypeView<ArchetypeValue>{ acheron };
+
+			view.ParallelEachBatch( []( std::span<const acs::AcheronUUID> uuids, std::span<ArchetypeValue> values ) {
+				for ( auto& value : values )
+					value.Value += 1;
+			}, 1024 );
+
+			view.ParallelEach( []( auto& components ) {
+				std::get<1>( components )->Value *= 2;
+			}, 1024 );
+
+			auto sum = uint32_t( 0 );
+
+			for ( auto [ entity, value ] : view )
+				sum += value->Value;
+
+			Assert::AreEqual( sum, uint32_t( entities.size( ) * 4 ) );
+		};
+
+	};
+
+};
@@ -35,11 +35,684 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	TEST ===
 ////////////////////////////////////////////////////////////////////////////////////////////
+namespace UnitTest {
+
+	struct SortedComp {
+
+		uint32_t Value = 0;
+
+	};
+
+	struct SparseComp {
+
+		uint32_t Value = 0;
+
+	};
+
+	struct EmptyComp { };
+
+	struct MarkerComp { };
+
+	struct FieldComp {
+
+		float X = 0.f;
+		float Y = 0.f;
+		uint32_t Id = 0;
+
+	};
+
+};
+
+namespace acs {
+
+	template<>
+	struct AcheronComponentTraits<UnitTest::SparseComp> {
+
+		static constexpr AcheronStorageTypes Storage = ACS_Storage_Sparse;
+
+	};
+
+	template<>
+	struct AcheronComponentTraits<UnitTest::EmptyComp> {
+
+		static constexpr AcheronStorageTypes Storage = ACS_Storage_Empty;
+
+	};
+
+	template<>
+	struct AcheronComponentTraits<UnitTest::FieldComp> {
+
+		static constexpr AcheronStorageTypes Storage = ACS_Storage_Fields;
+		static constexpr auto Fields = std::make_tuple( &UnitTest::FieldComp::X, &UnitTest::FieldComp::Y, &UnitTest::FieldComp::Id );
+
+	};
+
+};
+
 namespace UnitTest {
 
 	TEST_CLASS( Components ) {
 
 	public:
+		TEST_METHOD( SortedAppendRemove ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entity_1 = acheron.Create( );
+			auto entity_2 = acheron.Create( );
+
+			acheron.Append( entity_2, SortedComp{ 2 } );
+			acheron.Append( entity_1, SortedComp{ 1 } );
+
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entity_1 )->Value, uint32_t( 1 ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entity_2 )->Value, uint32_t( 2 ) );
+
+			acheron.Remove<SortedComp>( entity_1 );
+
+			Assert::IsNull( acheron.GetComponent<SortedComp>( entity_1 ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entity_2 )->Value, uint32_t( 2 ) );
+		};
+
+		TEST_METHOD( SortedAppendRange ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 6 );
+			auto& storage = acheron.GetStorage<SortedComp>( );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+			acheron.Append( entities[ 1 ], SortedComp{ 10 } );
+			acheron.Append( entities[ 4 ], SortedComp{ 40 } );
+
+			auto targets    = std::vector<acs::AcheronUUID>{ entities[ 0 ], entities[ 1 ], entities[ 3 ], entities[ 5 ] };
+			auto components = std::vector<SortedComp>{ { 0 }, { 1 }, { 3 }, { 5 } };
+			auto version    = storage.GetVersion( );
+
+			storage.AppendRange( targets, components );
+
+			Assert::AreEqual( storage.GetVersion( ), version + 1 );
+
+			storage.AppendRange( targets, components );
+
+			Assert::AreEqual( storage.GetVersion( ), version + 1 );
+			Assert::AreEqual( storage.GetCount( ), uint32_t( 5 ) );
+			Assert::IsTrue( std::is_sorted( storage.GetEntities( ).begin( ), storage.GetEntities( ).end( ) ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entities[ 0 ] )->Value, uint32_t( 0 ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entities[ 1 ] )->Value, uint32_t( 10 ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entities[ 4 ] )->Value, uint32_t( 40 ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entities[ 5 ] )->Value, uint32_t( 5 ) );
+		};
+
+		TEST_METHOD( SparseAppendRemove ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entity_1 = acheron.Create( );
+			auto entity_2 = acheron.Create( );
+			auto entity_3 = acheron.Create( );
+
+			acheron.Append( entity_1, SparseComp{ 1 } );
+			acheron.Append( entity_2, SparseComp{ 2 } );
+			acheron.Append( entity_3, SparseComp{ 3 } );
+			acheron.Remove<SparseComp>( entity_1 );
+
+			Assert::IsNull( acheron.GetComponent<SparseComp>( entity_1 ) );
+			Assert::AreEqual( acheron.GetComponent<SparseComp>( entity_2 )->Value, uint32_t( 2 ) );
+			Assert::AreEqual( acheron.GetComponent<SparseComp>( entity_3 )->Value, uint32_t( 3 ) );
+
+			auto count = uint32_t( 0 );
+
+			for ( auto [ entity, sorted, sparse ] : acs::AcheronComponentView<acs::AcheronTag, SparseComp>( acheron, acheron ) ) {
+				Assert::IsNotNull( sparse );
+				count += 1;
+			}
+
+			Assert::AreEqual( count, uint32_t( 2 ) );
+		};
+
+		TEST_METHOD( FieldAppendRemove ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 8 );
+			auto& storage = acheron.GetStorage<FieldComp>( );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index += 2 )
+				acheron.Append( entities[ index ], FieldComp{ float( index ), float( index ) * 2.f, index } );
+
+			auto targets    = std::vector<acs::AcheronUUID>{ entities[ 3 ], entities[ 1 ] };
+			auto components = std::vector<FieldComp>{ { 3.f, 6.f, 3 }, { 1.f, 2.f, 1 } };
+
+			storage.AppendRange( targets, components );
+			acheron.Remove<FieldComp>( entities[ 0 ] );
+			storage.RemoveRange( std::vector<acs::AcheronUUID>{ entities[ 4 ], entities[ 6 ] } );
+
+			Assert::AreEqual( storage.GetCount( ), uint32_t( 3 ) );
+			Assert::IsFalse( bool( acheron.GetComponent<FieldComp>( entities[ 0 ] ) ) );
+			Assert::AreEqual( acheron.GetComponent<FieldComp>( entities[ 3 ] )->Get<&FieldComp::Y>( ), 6.f );
+			Assert::AreEqual( acheron.GetComponent<FieldComp>( entities[ 2 ] ).Load( ).Id, uint32_t( 2 ) );
+			Assert::AreEqual( storage.GetField<&FieldComp::Id>( )[ 0 ], uint32_t( 1 ) );
+
+			auto count = uint32_t( 0 );
+
+			for ( auto [ entity, field ] : acs::AcheronComponentView<FieldComp>( acheron, acheron ) ) {
+				field->Get<&FieldComp::X>( ) += 1.f;
+				count += 1;
+			}
+
+			Assert::AreEqual( count, uint32_t( 3 ) );
+
+			acs::AcheronComponentView<const FieldComp, SortedComp>( acheron, acheron ).EachBatch( 
+				[ ]( std::span<const acs::AcheronUUID> uuids, acs::AcheronFieldSpan<const FieldComp> fields, std::span<SortedComp> sorted ) { }
+			);
+
+			acs::AcheronComponentView<FieldComp>( acheron, acheron ).EachBatch( 
+				[ & ]( std::span<const acs::AcheronUUID> uuids, acs::AcheronFieldSpan<FieldComp> fields ) {
+					auto xs = fields.Get<&FieldComp::X>( );
+					auto ys = fields.Get<&FieldComp::Y>( );
+
+					for ( auto index = size_t( 0 ); index < uuids.size( ); index++ )
+						xs[ index ] += ys[ index ];
+				}
+			);
+
+			Assert::AreEqual( acheron.GetComponent<FieldComp>( entities[ 1 ] )->Get<&FieldComp::X>( ), 4.f );
+			Assert::AreEqual( acheron.GetComponent<FieldComp>( entities[ 3 ] )->Get<&FieldComp::X>( ), 10.f );
+		};
+
+		TEST_METHOD( EmptyAppendRemove ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 6 );
+			auto& storage = acheron.GetStorage<EmptyComp>( );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index++ )
+				acheron.Append( entities[ index ], SortedComp{ index } );
+
+			auto targets    = std::vector<acs::AcheronUUID>{ entities[ 5 ], entities[ 1 ], entities[ 3 ] };
+			auto components = std::vector<EmptyComp>( targets.size( ) );
+
+			acheron.Append( entities[ 2 ], EmptyComp{ } );
+			storage.AppendRange( targets, components );
+			acheron.Remove<EmptyComp>( entities[ 3 ] );
+
+			static_assert( std::is_same_v<decltype( acheron.GetComponent<EmptyComp>( entities[ 1 ] ) ), const EmptyComp*> );
+
+			Assert::IsTrue( acs::AcheronComponentTraits<EmptyComp>::Storage == acs::ACS_Storage_Empty );
+			Assert::IsTrue( acs::AcheronComponentTraits<MarkerComp>::Storage == acs::ACS_Storage_Sorted );
+			Assert::AreEqual( storage.GetCount( ), uint32_t( 3 ) );
+			Assert::IsNotNull( acheron.GetComponent<EmptyComp>( entities[ 1 ] ) );
+			Assert::IsNull( acheron.GetComponent<EmptyComp>( entities[ 3 ] ) );
+
+			auto sum = uint32_t( 0 );
+
+			for ( auto [ entity, empty, sorted ] : acs::AcheronComponentView<const EmptyComp, SortedComp>( acheron, acheron ) ) {
+				Assert::IsNotNull( empty );
+				sum += sorted->Value;
+			}
+
+			Assert::AreEqual( sum, uint32_t( 1 + 2 + 5 ) );
+
+			sum = 0;
+
+			acs::AcheronComponentView<EmptyComp, const SortedComp>( acheron, acheron ).EachBatch( 
+				[ & ]( std::span<const acs::AcheronUUID> uuids, acs::AcheronEmptySpan<EmptyComp> empties, std::span<const SortedComp> sorted ) {
+					Assert::AreEqual( empties.size( ), sorted.size( ) );
+
+					for ( const auto& component : sorted )
+						sum += component.Value;
+				}
+			);
+
+			Assert::AreEqual( sum, uint32_t( 1 + 2 + 5 ) );
+
+			acheron.Destroy( entities[ 2 ], true );
+			acheron.Sweep( );
+
+			Assert::AreEqual( storage.GetCount( ), uint32_t( 2 ) );
+		};
+
+		TEST_METHOD( TagFilter ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 130 );
+			auto ignored  = uint32_t( 0 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index++ ) {
+				acheron.Append( entities[ index ], SortedComp{ index } );
+
+				if ( index % 3 == 0 ) {
+					acheron.GetComponent<acs::AcheronTag>( entities[ index ] )->Flags |= acs::ACS_Ignore;
+					ignored += 1;
+				}
+			}
+
+			auto view    = acs::AcheronComponentView<SortedComp>( acheron, acheron );
+			auto visible = view.WithTags( acs::ACS_Ignore, false );
+			auto hidden  = view.WithTags( acs::ACS_Ignore, true );
+
+			Assert::AreEqual( view.GetCount( ), uint32_t( entities.size( ) ) );
+			Assert::AreEqual( visible.GetCount( ), uint32_t( entities.size( ) ) - ignored );
+			Assert::AreEqual( hidden.GetCount( ), ignored );
+			Assert::AreEqual( view.WithTags( acs::AcheronTagFilter{ } ).GetCount( ), view.GetCount( ) );
+
+			for ( auto [ entity, sorted ] : visible )
+				Assert::AreNotEqual( sorted->Value % 3, uint32_t( 0 ) );
+
+			auto sum = uint32_t( 0 );
+
+			hidden.EachBatch( [ & ]( std::span<const acs::AcheronUUID> uuids, std::span<SortedComp> sorted ) {
+				for ( const auto& component : sorted )
+					sum += component.Value;
+			} );
+
+			Assert::AreEqual( sum, uint32_t( ( 0 + 129 ) * 44 / 2 ) );
+
+			acheron.GetComponent<acs::AcheronTag>( entities[ 4 ] )->Flags |= uint64_t( 1 ) << 1;
+			acheron.GetComponent<acs::AcheronTag>( entities[ 6 ] )->Flags |= uint64_t( 1 ) << 1;
+
+			Assert::AreEqual( view.WithAnyTags( uint64_t( 1 ) << 1 ).GetCount( ), uint32_t( 2 ) );
+			Assert::AreEqual( visible.WithAnyTags( uint64_t( 1 ) << 1 ).GetCount( ), uint32_t( 1 ) );
+
+			acheron.Remove<acs::AcheronTag>( entities[ 0 ] );
+
+			auto untagged = acs::AcheronComponentView<SortedComp>( acheron, acheron ).WithTags( acs::ACS_Ignore, false );
+
+			Assert::AreEqual( untagged.GetCount( ), uint32_t( entities.size( ) ) - ignored + 1 );
+		};
+
+		TEST_METHOD( AppendRemoveRange ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 64 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			auto targets = std::vector<acs::AcheronUUID>( entities.rbegin( ), entities.rend( ) );
+			auto sorted  = std::vector<SortedComp>( targets.size( ) );
+			auto sparse  = std::vector<SparseComp>( targets.size( ) );
+
+			targets.emplace_back( entities[ 0 ] );
+			sorted.emplace_back( SortedComp{ 1000 } );
+			sparse.emplace_back( SparseComp{ 1000 } );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index++ ) {
+				sorted[ index ].Value = index;
+				sparse[ index ].Value = index;
+			}
+
+			acheron.AppendRange<SortedComp>( targets, sorted );
+			acheron.AppendRange<SparseComp>( targets, sparse );
+
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentCount<SortedComp>( ), uint32_t( 64 ) );
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentCount<SparseComp>( ), uint32_t( 64 ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entities[ 0 ] )->Value, uint32_t( 63 ) );
+			Assert::AreEqual( acheron.GetComponent<SparseComp>( entities[ 0 ] )->Value, uint32_t( 63 ) );
+
+			const auto version = acheron.GetComponentManager( ).GetComponentVersion<SparseComp>( );
+
+			acheron.AppendRange<SparseComp>( targets, sparse );
+
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentVersion<SparseComp>( ), version );
+
+			auto removed = std::vector<acs::AcheronUUID>{ entities[ 40 ], entities[ 2 ], entities[ 40 ], entities[ 63 ] };
+
+			acheron.RemoveRange<SortedComp>( removed );
+			acheron.RemoveRange<SparseComp>( removed );
+
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentCount<SortedComp>( ), uint32_t( 61 ) );
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentCount<SparseComp>( ), uint32_t( 61 ) );
+			Assert::IsNull( acheron.GetComponent<SortedComp>( entities[ 2 ] ) );
+			Assert::IsNull( acheron.GetComponent<SparseComp>( entities[ 63 ] ) );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( entities[ 3 ] )->Value, uint32_t( 60 ) );
+
+			auto count = uint32_t( 0 );
+
+			for ( auto components : acs::AcheronComponentView<SortedComp, SparseComp>( acheron, acheron ) )
+				count += 1;
+
+			Assert::AreEqual( count, uint32_t( 61 ) );
+		};
+
+		TEST_METHOD( Sweep ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 100 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index++ ) {
+				acheron.Append( entities[ index ], SortedComp{ index } );
+				acheron.Append( entities[ index ], SparseComp{ index } );
+			}
+
+			auto other = acheron.Create( );
+
+			acheron.Append( other, SortedComp{ 1000 } );
+
+			const auto version = acheron.GetComponentManager( ).GetComponentVersion<acs::AcheronDestructor>( );
+
+			for ( auto index = uint32_t( 99 ); index > 0; index -= 3 )
+				acheron.Destroy( entities[ index ], true );
+
+			acheron.Sweep( );
+
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentCount<SortedComp>( ), uint32_t( 68 ) );
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentCount<SparseComp>( ), uint32_t( 67 ) );
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentVersion<acs::AcheronDestructor>( ), version );
+			Assert::AreEqual( acheron.GetComponent<SortedComp>( other )->Value, uint32_t( 1000 ) );
+
+			for ( auto index = uint32_t( 0 ); index < entities.size( ); index++ ) {
+				const auto* component = acheron.GetComponent<SortedComp>( entities[ index ] );
+
+				if ( index > 0 && index % 3 == 0 )
+					Assert::IsNull( component );
+				else
+					Assert::AreEqual( component->Value, index );
+			}
+		};
+
+		TEST_METHOD( ContextOwnership ) {
+			auto acheron_1 = acs::AcheronContext{ };
+			auto acheron_2 = acs::AcheronContext{ };
+			auto entity_1  = acheron_1.Create( );
+			auto entity_2  = acheron_2.Create( );
+
+			acheron_1.Append( entity_1, SortedComp{ 1 } );
+
+			Assert::AreEqual( entity_1, entity_2 );
+			Assert::IsNotNull( acheron_1.GetComponent<SortedComp>( entity_1 ) );
+			Assert::IsNull( acheron_2.GetComponent<SortedComp>( entity_2 ) );
+			Assert::AreNotEqual( &acheron_1.GetStorage<SortedComp>( ), &acheron_2.GetStorage<SortedComp>( ) );
+		};
+
+		TEST_METHOD( ComponentUUID ) {
+			constexpr auto uuid_a  = acs::AcheronUUID::Make<SortedComp>( );
+			constexpr auto uuid_ab = acs::AcheronUUID::Make<SortedComp, SparseComp>( );
+			constexpr auto uuid_ba = acs::AcheronUUID::Make<SparseComp, SortedComp>( );
+			constexpr auto uuid_aa = acs::AcheronUUID::Make<SortedComp, SortedComp>( );
+
+			static_assert( uuid_ab.Value == uuid_ba.Value );
+			static_assert( uuid_a.Value == acs::AcheronUUID::Make<const SortedComp>( ).Value );
+			static_assert( acs::HashTypeName( "struct UnitTest::SortedComp" ) == acs::HashTypeName( "UnitTest::SortedComp" ) );
+			static_assert( acs::HashTypeName( "std::pair<int,float>" ) == acs::HashTypeName( "std::pair<int, float>" ) );
+
+			Assert::AreNotEqual( uuid_a, uuid_ab );
+			Assert::AreNotEqual( uuid_aa, acs::AcheronUUID::Make<>( ) );
+			Assert::AreNotEqual( uuid_aa, uuid_a );
+		};
+
+		TEST_METHOD( ViewIteration ) {
+			auto acheron = acs::AcheronContext{ };
+
+			for ( auto index = uint32_t( 0 ); index < 64; index++ ) {
+				auto entity = acheron.Create( );
+
+				if ( index % 2 == 0 )
+					acheron.Append( entity, SortedComp{ index } );
+
+				if ( index % 3 == 0 )
+					acheron.Append( entity, SparseComp{ index } );
+			}
+
+			auto count = uint32_t( 0 );
+
+			for ( auto [ entity, sorted, sparse ] : acs::AcheronComponentView<SortedComp, SparseComp>( acheron, acheron ) ) {
+				Assert::AreEqual( sorted->Value, sparse->Value );
+				Assert::AreEqual( sorted->Value % 6, uint32_t( 0 ) );
+				Assert::AreEqual( acheron.GetComponent<SortedComp>( entity ), sorted );
+
+				count += 1;
+			}
+
+			Assert::AreEqual( count, uint32_t( 11 ) );
+		};
+
+		TEST_METHOD( ViewStructuralChange ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto unviewed = std::vector<acs::AcheronUUID>{ };
+
+			for ( auto index = uint32_t( 0 ); index < 64; index++ ) {
+				auto entity = acheron.Create( );
+
+				acheron.Append( entity, SortedComp{ index } );
+
+				if ( index % 3 == 0 )
+					acheron.Append( entity, SparseComp{ index } );
+				else
+					unviewed.emplace_back( entity );
+			}
+
+			auto count = uint32_t( 0 );
+
+			for ( auto [ entity, sorted, sparse ] : acs::AcheronComponentView<SortedComp, SparseComp>( acheron, acheron ) ) {
+				Assert::IsNotNull( sorted );
+				Assert::AreEqual( sorted->Value, sparse->Value );
+				Assert::AreEqual( acheron.GetComponent<SortedComp>( entity ), sorted );
+
+				if ( count == 1 ) {
+					for ( const auto other : unviewed )
+						acheron.Remove<SortedComp>( other );
+				}
+
+				count += 1;
+			}
+
+			Assert::AreEqual( count, uint32_t( 22 ) );
+			Assert::AreEqual( acheron.GetStorage<SortedComp>( ).GetCount( ), uint32_t( 22 ) );
+		};
+
+		TEST_METHOD( IncrementalCache ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 256 );
+
+			for ( auto& entity : entities ) {
+				entity = acheron.Create( );
+
+				acheron.Append( entity, SortedComp{ } );
+				acheron.Append( entity, SparseComp{ } );
+			}
+
+			auto get_count = [ & ]( ) -> uint32_t {
+				auto count = uint32_t( 0 );
+
+				for ( auto [ entity, sorted, sparse ] : acs::AcheronComponentView<SortedComp, SparseComp>( acheron, acheron ) ) {
+					Assert::IsNotNull( sorted );
+					Assert::IsNotNull( sparse );
+
+					count += 1;
+				}
+
+				return count;
+			};
+
+			Assert::AreEqual( get_count( ), uint32_t( 256 ) );
+
+			acheron.Remove<SortedComp>( entities[ 10 ] );
+			acheron.Remove<SparseComp>( entities[ 20 ] );
+			acheron.Remove<SparseComp>( entities[ 30 ] );
+			acheron.Append( entities[ 30 ], SparseComp{ } );
+
+			Assert::AreEqual( get_count( ), uint32_t( 254 ) );
+
+			acheron.Append( entities[ 10 ], SortedComp{ } );
+
+			Assert::AreEqual( get_count( ), uint32_t( 255 ) );
+		};
+
+		TEST_METHOD( ChangeLogLimit ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 1600 );
+			auto& storage = acheron.GetStorage<acs::AcheronTag>( );
+
+			acheron.Create( 1000, entities );
+
+			Assert::IsTrue( storage.GetChanges( ).empty( ) );
+
+			acheron.Create( 600, std::span<acs::AcheronUUID>{ entities.begin( ) + 1000, entities.end( ) } );
+
+			Assert::IsTrue( storage.GetChanges( ).empty( ) );
+
+			acheron.Remove<acs::AcheronTag>( entities[ 10 ] );
+
+			Assert::AreEqual( storage.GetChanges( ).size( ), size_t( 1 ) );
+			Assert::AreEqual( storage.GetChangesVersion( ) + 1, storage.GetVersion( ) );
+		};
+
+		TEST_METHOD( SwappedViewCache ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 202 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			auto targets = std::span<const acs::AcheronUUID>{ entities.begin( ) + 2, entities.end( ) };
+			auto sorted  = std::vector<SortedComp>( targets.size( ) );
+			auto sparse  = std::vector<SparseComp>( targets.size( ) );
+
+			acheron.Append( entities[ 1 ], SortedComp{ } );
+			acheron.AppendRange<SortedComp>( targets, sorted );
+			acheron.Append( entities[ 0 ], SortedComp{ } );
+			acheron.Append( entities[ 0 ], SparseComp{ } );
+			acheron.AppendRange<SparseComp>( targets, sparse );
+
+			auto get_count = [ & ]<typename... CompTypes>( ) -> uint32_t {
+				return acs::AcheronComponentView<CompTypes...>( acheron, acheron ).GetCount( );
+			};
+
+			Assert::AreEqual( get_count.template operator()<SortedComp, SparseComp>( ), uint32_t( 201 ) );
+
+			acheron.Append( entities[ 1 ], SparseComp{ } );
+
+			Assert::AreEqual( get_count.template operator()<SparseComp, SortedComp>( ), uint32_t( 202 ) );
+			Assert::AreEqual( get_count.template operator()<SortedComp, SparseComp>( ), uint32_t( 202 ) );
+		};
+
+		TEST_METHOD( SharedStorageViews ) {
+			auto acheron = acs::AcheronContext{ };
+			auto entity  = acheron.Create( );
+
+			acheron.Append( entity, SortedComp{ } );
+			acheron.Append( entity, SparseComp{ } );
+
+			auto get_count = [ & ]<typename... CompTypes>( ) -> uint32_t {
+				auto count = uint32_t( 0 );
+
+				for ( auto components : acs::AcheronComponentView<CompTypes...>( acheron, acheron ) )
+					count += 1;
+
+				return count;
+			};
+
+			Assert::AreEqual( get_count.template operator()<SortedComp>( ), uint32_t( 1 ) );
+			Assert::AreEqual( get_count.template operator()<SortedComp, SparseComp>( ), uint32_t( 1 ) );
+
+			acheron.Remove<SortedComp>( entity );
+
+			Assert::AreEqual( get_count.template operator()<SortedComp>( ), uint32_t( 0 ) );
+			Assert::AreEqual( get_count.template operator()<SortedComp, SparseComp>( ), uint32_t( 0 ) );
+			Assert::AreEqual( get_count.template operator()<SparseComp>( ), uint32_t( 1 ) );
+		};
+
+		TEST_METHOD( Bench_View ) {
+			for ( auto count : { 10000, 100000, 1000000 } ) {
+				auto acheron = acs::AcheronContext{ };
+
+				acheron.Resize( count );
+
+				for ( auto index = 0; index < count; index++ )
+					acheron.Append( acheron.Create( ), SortedComp{ uint32_t( index ) } );
+
+				auto view  = acs::AcheronComponentView<acs::AcheronHierarchy, acs::AcheronTag, SortedComp>( acheron, acheron );
+				auto total = uint64_t( 0 );
+
+				acs_test::Bench( std::format( L"View 3 components {}", count ), uint32_t( count ), [ & ]( ) {
+					for ( auto [ entity, hierarchy, tag, sorted ] : view )
+						total += sorted->Value + tag->Flags;
+				} );
+
+				Assert::AreNotEqual( total, uint64_t( 0 ) );
+			}
+		};
+
+		TEST_METHOD( Bench_Range ) {
+			for ( auto count : { 1000u, 10000u, 100000u } ) {
+				auto acheron  = acs::AcheronContext{ };
+				auto entities = std::vector<acs::AcheronUUID>( count );
+
+				acheron.Create( count, entities );
+
+				std::reverse( entities.begin( ), entities.end( ) );
+
+				acs_test::Bench( L"Append", count, [ & ]( ) {
+					for ( const auto entity : entities )
+						acheron.Append( entity, SortedComp{ } );
+				} );
+
+				acs_test::Bench( L"Remove", count, [ & ]( ) {
+					for ( const auto entity : entities )
+						acheron.Remove<SortedComp>( entity );
+				} );
+
+				auto components = std::vector<SortedComp>( count );
+
+				acs_test::Bench( L"AppendRange", count, [ & ]( ) {
+					acheron.AppendRange<SortedComp>( entities, components );
+				} );
+
+				acs_test::Bench( L"RemoveRange", count, [ & ]( ) {
+					acheron.RemoveRange<SortedComp>( entities );
+				} );
+			}
+		};
+
+		TEST_METHOD( Bench_Sweep ) {
+			for ( auto count : { 10000u, 100000u, 1000000u } ) {
+				auto acheron  = acs::AcheronContext{ };
+				auto entities = std::vector<acs::AcheronUUID>( count );
+				auto sorted   = std::vector<SortedComp>( count );
+				auto sparse   = std::vector<SparseComp>( count );
+
+				acheron.Create( count, entities );
+				acheron.AppendRange<SortedComp>( entities, sorted );
+				acheron.AppendRange<SparseComp>( entities, sparse );
+
+				std::shuffle( entities.begin( ), entities.end( ), std::mt19937{ count } );
+
+				for ( auto index = uint32_t( 0 ); index < count / 5; index++ )
+					acheron.Destroy( entities[ index ], true );
+
+				acs_test::Bench( L"Sweep 20%", count / 5, [ & ]( ) {
+					acheron.Sweep( );
+				} );
+			}
+		};
+
+		TEST_METHOD( Bench_Storage ) {
+			for ( auto count : { 1000, 10000, 100000 } ) {
+				auto acheron  = acs::AcheronContext{ };
+				auto entities = std::vector<acs::AcheronUUID>( size_t( count ) );
+
+				acheron.Resize( count );
+
+				for ( auto& entity : entities )
+					entity = acheron.Create( );
+
+				acs_test::Bench( std::format( L"Sorted Append {}", count ), [ & ]( ) {
+					for ( auto entity : entities )
+						acheron.Append( entity, SortedComp{ } );
+				} );
+
+				acs_test::Bench( std::format( L"Sparse Append {}", count ), [ & ]( ) {
+					for ( auto entity : entities )
+						acheron.Append( entity, SparseComp{ } );
+				} );
+
+				acs_test::Bench( std::format( L"Sorted Remove {}", count ), [ & ]( ) {
+					for ( auto entity : entities )
+						acheron.Remove<SortedComp>( entity );
+				} );
+
+				acs_test::Bench( std::format( L"Sparse Remove {}", count ), [ & ]( ) {
+					for ( auto entity : entities )
+						acheron.Remove<SparseComp>( entity );
+				} );
+			}
+		};
+
 		/*
 		TEST_METHOD( GetReflectType ) {
 			const auto* test_int = micro::GetReflectType<int32_t>( );
@@ -113,6 +113,60 @@ namespace UnitTest {
 			Assert::IsTrue( acheron.GetIsAlive( entity_2 ) );
 		};
 
+		TEST_METHOD( ReUsePolicy ) {
+			auto manager  = acs::AcheronEntityManager{ };
+			auto entities = std::vector<acs::AcheronUUID>( 4 );
+
+			auto get_index = []( const acs::AcheronUUID entity ) -> uint32_t {
+				return uint32_t( entity.Value & 0xffffffff );
+			};
+
+			for ( auto& entity : entities )
+				entity = manager.Create( );
+
+			for ( const auto entity : entities )
+				manager.Destroy( entity, false );
+
+			Assert::AreEqual( std::invoke( get_index, manager.Create( ) ), uint32_t( 0 ) );
+
+			manager.SetReusePolicy( acs::ACS_Reuse_LIFO );
+
+			Assert::AreEqual( std::invoke( get_index, manager.Create( ) ), uint32_t( 3 ) );
+			Assert::AreEqual( std::invoke( get_index, manager.Create( ) ), uint32_t( 2 ) );
+
+			manager.Destroy( entities[ 0 ], false );
+
+			Assert::AreEqual( manager.GetCount( ), uint32_t( 3 ) );
+		};
+
+		TEST_METHOD( BulkCreateDestroy ) {
+			auto acheron  = acs::AcheronContext{ };
+			auto entities = std::vector<acs::AcheronUUID>( 512 );
+			auto single   = acheron.Create( );
+			auto version  = acheron.GetComponentManager( ).GetComponentVersion<acs::AcheronTag>( );
+
+			acheron.Destroy( single, true );
+			acheron.Create( uint32_t( entities.size( ) ), entities, acs::AcheronTag{ acs::ACS_Ignore } );
+
+			Assert::AreEqual( acheron.GetEntityCount( ), uint32_t( entities.size( ) ) );
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentVersion<acs::AcheronTag>( ), version + 1 );
+			Assert::IsTrue( std::is_sorted( entities.begin( ), entities.end( ) ) );
+
+			for ( const auto entity : entities ) {
+				Assert::IsTrue( acheron.GetIsAlive( entity ) );
+				Assert::IsNotNull( acheron.GetComponent<acs::AcheronHierarchy>( entity ) );
+				Assert::AreEqual( acheron.GetComponent<acs::AcheronTag>( entity )->Flags, uint64_t( acs::ACS_Ignore ) );
+			}
+
+			acheron.Destroy( entities, true );
+
+			Assert::AreEqual( acheron.GetEntityCount( ), uint32_t( 0 ) );
+
+			acheron.Sweep( );
+
+			Assert::AreEqual( acheron.GetComponentManager( ).GetComponentCount<acs::AcheronTag>( ), uint32_t( 0 ) );
+		};
+
 		TEST_METHOD( Bench_Create ) {
 			auto acheron = acs::AcheronContext{ };
 
@@ -126,6 +180,49 @@ namespace UnitTest {
 			}
 		};
 
+		TEST_METHOD( Bench_BulkCreate ) {
+			const auto count = uint32_t( 50000 );
+			auto entities    = std::vector<acs::AcheronUUID>( count );
+
+			{
+				auto acheron = acs::AcheronContext{ };
+
+				acs_test::Bench( L"Context Create", count, [ & ]( ) {
+					for ( auto& entity : entities )
+						entity = acheron.Create( );
+				} );
+			}
+
+			{
+				auto acheron = acs::AcheronContext{ };
+
+				acs_test::Bench( L"Context Bulk Create", count, [ & ]( ) {
+					acheron.Create( count, entities );
+				} );
+			}
+		};
+
+		TEST_METHOD( Bench_ReUse ) {
+			for ( auto policy : { acs::ACS_Reuse_FIFO, acs::ACS_Reuse_LIFO } ) {
+				auto manager  = acs::AcheronEntityManager{ };
+				auto entities = std::vector<acs::AcheronUUID>( 100000 );
+				auto count    = uint32_t( entities.size( ) );
+
+				manager.SetReusePolicy( policy );
+
+				for ( auto& entity : entities )
+					entity = manager.Create( );
+
+				acs_test::Bench( L"Destroy Create", count, [ & ]( ) {
+					for ( auto& entity : entities ) {
+						manager.Destroy( entity, false );
+
+						entity = manager.Create( );
+					}
+				} );
+			}
+		};
+
 	};
 
 };
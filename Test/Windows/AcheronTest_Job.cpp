@@ -0,0 +1,164 @@
+/**
+ *               _
+ *     /\       | |
+ *    /  \   ___| |__   ___ _ __ ___  _ __
+ *   / /\ \ / __| '_ \ / _ \ '__/ _ \| '_ \
+ *  / ____ \ (__| | | |  __/ | | (_) | | | |
+ * /_/    \_\___|_| |_|\___|_|  \___/|_| |_|
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "AcheronTest_Utils.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	TEST ===
+////////////////////////////////////////////////////////////////////////////////////////////
+namespace UnitTest {
+
+	TEST_CLASS( Jobs ) {
+
+	public:
+		TEST_METHOD( Schedule ) {
+			for ( auto worker_count : { 0u, 4u } ) {
+				auto job_system = acs::AcheronJobSystem{ };
+				auto counter    = acs::AcheronJobCounter{ };
+				auto sum        = std::atomic<uint32_t>{ 0 };
+
+				job_system.Resize( worker_count );
+
+				for ( auto index = uint32_t( 0 ); index < 1000; index++ )
+					job_system.Schedule( [ &sum, index ]( ) { sum += index; }, &counter );
+
+				job_system.WaitFor( counter );
+
+				Assert::AreEqual( sum.load( ), uint32_t( 499500 ) );
+				Assert::IsTrue( counter.GetIsDone( ) );
+			}
+		};
+
+		TEST_METHOD( Dependency ) {
+			for ( auto worker_count : { 0u, 4u } ) {
+				auto job_system = acs::AcheronJobSystem{ };
+				auto first      = acs::AcheronJobCounter{ };
+				auto second     = acs::AcheronJobCounter{ };
+				auto values     = std::vector<uint32_t>( 64, 0 );
+				auto is_ordered = std::atomic<bool>{ true };
+
+				job_system.Resize( worker_count );
+
+				for ( auto index = uint32_t( 0 ); index < values.size( ); index++ )
+					job_system.Schedule( [ &values, index ]( ) { values[ index ] = index + 1; }, &first );
+
+				job_system.Schedule( [ & ]( ) {
+					for ( auto index = uint32_t( 0 ); index < values.size( ); index++ ) {
+						if ( values[ index ] != index + 1 )
+							is_ordered = false;
+					}
+				}, &second, first );
+
+				job_system.WaitFor( second );
+
+				Assert::IsTrue( is_ordered.load( ) );
+			}
+		};
+
+		TEST_METHOD( NestedWait ) {
+			auto job_system = acs::AcheronJobSystem{ };
+			auto counter    = acs::AcheronJobCounter{ };
+			auto sum        = std::atomic<uint32_t>{ 0 };
+
+			job_system.Resize( 2 );
+
+			for ( auto outer = 0; outer < 8; outer++ ) {
+				job_system.Schedule( [ & ]( ) {
+					auto inner_counter = acs::AcheronJobCounter{ };
+
+					for ( auto inner = 0; inner < 8; inner++ )
+						job_system.Schedule( [ &sum ]( ) { sum += 1; }, &inner_counter );
+
+					job_system.WaitFor( inner_counter );
+				}, &counter );
+			}
+
+			job_system.WaitFor( counter );
+
+			Assert::AreEqual( sum.load( ), uint32_t( 64 ) );
+		};
+
+		TEST_METHOD( ParallelFor ) {
+			auto job_system = acs::AcheronJobSystem{ };
+			auto values     = std::vector<uint32_t>( 10000, 0 );
+
+			job_system.Resize( 4 );
+			job_system.ParallelFor( uint32_t( values.size( ) ), 64, [ & ]( uint32_t start, uint32_t stop ) {
+				for ( auto index = start; index < stop; index++ )
+					values[ index ] += 1;
+			} );
+
+			Assert::IsTrue( std::all_of( values.begin( ), values.end( ), []( const uint32_t value ) { return value == 1; } ) );
+		};
+
+		TEST_METHOD( Bench_Throughput ) {
+			const auto count = uint32_t( 100000 );
+
+			for ( auto worker_count : { 0u, std::max( std::thread::hardware_concurrency( ), 2u ) - 1 } ) {
+				auto job_system = acs::AcheronJobSystem{ };
+				auto sum        = std::atomic<uint32_t>{ 0 };
+
+				job_system.Resize( worker_count );
+
+				acs_test::Bench( L"Job throughput " + std::to_wstring( worker_count ) + L" workers", count, [ & ]( ) {
+					auto counter = acs::AcheronJobCounter{ };
+
+					for ( auto index = uint32_t( 0 ); index < count; index++ )
+						job_system.Schedule( [ &sum ]( ) { sum.fetch_add( 1, std::memory_order_relaxed ); }, &counter );
+
+					job_system.WaitFor( counter );
+				} );
+			}
+		};
+
+		TEST_METHOD( Bench_Latency ) {
+			const auto count = uint32_t( 10000 );
+
+			for ( auto worker_count : { 1u, std::max( std::thread::hardware_concurrency( ), 2u ) - 1 } ) {
+				auto job_system = acs::AcheronJobSystem{ };
+
+				job_system.Resize( worker_count );
+
+				acs_test::Bench( L"Job round trip " + std::to_wstring( worker_count ) + L" workers", count, [ & ]( ) {
+					for ( auto index = uint32_t( 0 ); index < count; index++ ) {
+						auto counter = acs::AcheronJobCounter{ };
+
+						job_system.Schedule( [ ]( ) { }, &counter );
+						job_system.WaitFor( counter );
+					}
+				} );
+			}
+		};
+
+	};
+
+};
@@ -68,6 +68,308 @@ namespace UnitTest {
 
 	};
 
+	struct Position {
+
+		float Value = 0.f;
+
+	};
+
+	struct Velocity {
+
+		float Value = 1.f;
+
+	};
+
+	struct Age {
+
+		uint32_t Value = 0;
+
+	};
+
+	class MoveSystem 
+		: public acs::AcheronSystem<Position, const Velocity>
+	{
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, Position*, const Velocity*>& components
+		) {
+			auto [ entity, position, velocity ] = components;
+
+			position->Value += velocity->Value;
+		};
+
+	};
+
+	class ParallelMoveSystem
+		: public acs::AcheronSystem<Position, const Velocity>
+	{
+
+	public:
+		ParallelMoveSystem( )
+			: acs::AcheronSystem<Position, const Velocity>{ 256 }
+		{ };
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, Position*, const Velocity*>& components
+		) {
+			auto [ entity, position, velocity ] = components;
+
+			position->Value += velocity->Value;
+		};
+
+	};
+
+	class BatchMoveSystem
+		: public acs::AcheronSystem<Position, const Velocity>
+	{
+
+	public:
+		uint32_t BatchCount = 0;
+
+	protected:
+		virtual void OnProcessBatch(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::span<const acs::AcheronUUID> entities,
+			std::span<Position> positions,
+			std::span<const Velocity> velocities
+		) override {
+			for ( auto index = size_t( 0 ); index < entities.size( ); index++ )
+				positions[ index ].Value += velocities[ index ].Value;
+
+			BatchCount += 1;
+		};
+
+	};
+
+	class StructuralMoveSystem
+		: public acs::AcheronSystem<Position, const Velocity>
+	{
+
+	public:
+		acs::AcheronUUID Target = { };
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, Position*, const Velocity*>& components
+		) {
+			auto [ entity, position, velocity ] = components;
+
+			if ( velocity != nullptr )
+				position->Value += velocity->Value;
+
+			if ( Target != acs::AcheronUUID{ } ) {
+				auto entities = std::vector<acs::AcheronUUID>( 4096 );
+
+				context.Create( uint32_t( entities.size( ) ), entities );
+
+				for ( const auto other : entities )
+					context.Append( other, Position{ } );
+
+				context.Remove<Velocity>( Target );
+
+				Target = { };
+			}
+		};
+
+	};
+
+	class AgeSystem
+		: public acs::AcheronSystem<Age>
+	{
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, Age*>& components
+		) {
+			std::get<1>( components )->Value += 1;
+		};
+
+	};
+
+	class SumSystem
+		: public acs::AcheronSystem<const Position>
+	{
+
+	public:
+		float Sum = 0.f;
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, const Position*>& components
+		) {
+			Sum += std::get<1>( components )->Value;
+		};
+
+	};
+
+	class FilteredSumSystem
+		: public acs::AcheronSystem<const Position>
+	{
+
+	public:
+		FilteredSumSystem( )
+			: acs::AcheronSystem<const Position>{ 0, { acs::ACS_None, acs::ACS_None, acs::ACS_Ignore } }
+		{ };
+
+	};
+
+	class IgnoreSystem
+		: public acs::AcheronSystem<acs::AcheronTag>
+	{
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, acs::AcheronTag*>& components
+		) {
+			std::get<1>( components )->Flags |= acs::ACS_Ignore;
+		};
+
+	};
+
+	class StaticMoveSystem
+		: public acs::AcheronStaticSystem<StaticMoveSystem, Position, const Velocity>
+	{
+
+	public:
+		void OnProcessBatch(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::span<const acs::AcheronUUID> entities,
+			std::span<Position> positions,
+			std::span<const Velocity> velocities
+		) {
+			for ( auto index = size_t( 0 ); index < entities.size( ); index++ )
+				positions[ index ].Value += velocities[ index ].Value;
+		};
+
+	};
+
+	class StaticClampSystem
+		: public acs::AcheronStaticSystem<StaticClampSystem, Position, const Velocity>
+	{
+
+	public:
+		void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, Position*, const Velocity*>& components
+		) {
+			auto* position = std::get<1>( components );
+
+			position->Value = std::min( position->Value, 3.f );
+		};
+
+	};
+
+	class StaticAgeSystem
+		: public acs::AcheronStaticSystem<StaticAgeSystem, Age>
+	{
+
+	public:
+		void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, Age*>& components
+		) {
+			std::get<1>( components )->Value += 1;
+		};
+
+	};
+
+	template<uint32_t Id>
+	struct Work {
+
+		float Value = 1.f;
+
+	};
+
+	template<uint32_t Id>
+	class WorkSystem
+		: public acs::AcheronSystem<Work<Id>>
+	{
+
+	protected:
+		virtual void OnProcess(
+			acs::AcheronContext& context,
+			void* user_data,
+			std::tuple<acs::AcheronUUID, Work<Id>*>& components
+		) {
+			auto* work = std::get<1>( components );
+
+			for ( auto step = 0; step < 32; step++ )
+				work->Value = std::sqrt( work->Value * work->Value + 1.f );
+		};
+
+	};
+
+	template<uint32_t Id>
+	class ConcurrentSystem
+		: public acs::AcheronSystem<Work<Id>>
+	{
+
+	public:
+		bool IsConcurrent = false;
+
+	public:
+		virtual void Process( acs::AcheronContext& context, void* user_data ) override {
+			IsConcurrent = context.GetComponentManager( ).GetIsConcurrent( );
+
+			acs::AcheronSystem<Work<Id>>::Process( context, user_data );
+		};
+
+	};
+
+	template<uint32_t Id>
+	class LogSystem
+		: public acs::IAcheronSystem
+	{
+
+	public:
+		virtual void Process( acs::AcheronContext& context, void* user_data ) override {
+			static_cast<std::vector<uint32_t>*>( user_data )->emplace_back( Id );
+		};
+
+	};
+
+	class CountBackend final
+		: public acs::IAcheronProfileBackend
+	{
+
+	public:
+		std::unordered_map<std::string_view, uint32_t> Begins;
+		std::unordered_map<std::string_view, uint32_t> Ends;
+		std::unordered_map<std::string_view, int64_t> Counters;
+
+	public:
+		virtual void BeginScope( const std::string_view name ) override {
+			Begins[ name ] += 1;
+		};
+
+		virtual void EndScope( const std::string_view name ) override {
+			Ends[ name ] += 1;
+		};
+
+		virtual void Counter( const std::string_view name, const int64_t value ) override {
+			Counters[ name ] = value;
+		};
+
+	};
+
 	TEST_CLASS( Systems ) {
 
 	public:
@@ -82,6 +384,523 @@ namespace UnitTest {
 			test_system.Process( context, nullptr );
 		};
 
+		TEST_METHOD( Access ) {
+			const auto move_access = acs::AcheronSystemAccess::Make<Position, const Velocity>( );
+			const auto age_access  = acs::AcheronSystemAccess::Make<Age>( );
+			const auto sum_access  = acs::AcheronSystemAccess::Make<const Position>( );
+
+			Assert::IsFalse( move_access.GetIsConflicting( age_access ) );
+			Assert::IsTrue( move_access.GetIsConflicting( sum_access ) );
+			Assert::IsFalse( sum_access.GetIsConflicting( acs::AcheronSystemAccess::Make<const Position, const Velocity>( ) ) );
+			Assert::IsTrue( age_access.GetIsConflicting( acs::AcheronSystemAccess{ true } ) );
+		};
+
+		TEST_METHOD( ParallelProcess ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto entities = std::vector<acs::AcheronUUID>( 1000 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities ) {
+				acheron.Append( entity, Position{ } );
+				acheron.Append( entity, Velocity{ } );
+				acheron.Append( entity, Age{ } );
+			}
+
+			acheron.ResizeWorkerPool( 4 );
+			acheron.Register<MoveSystem>( true );
+			acheron.Register<AgeSystem>( true );
+
+			auto* sum_system = acheron.Register<SumSystem>( true );
+
+			Assert::IsNotNull( sum_system );
+			Assert::AreEqual( acheron.GetSystemManager( ).GetBatchCount( ), uint32_t( 2 ) );
+
+			for ( auto frame = 0; frame < 8; frame++ )
+				acheron.Process( nullptr );
+
+			for ( const auto entity : entities ) {
+				Assert::AreEqual( acheron.GetComponent<Position>( entity )->Value, 8.f );
+				Assert::AreEqual( acheron.GetComponent<Age>( entity )->Value, uint32_t( 8 ) );
+			}
+
+			Assert::IsTrue( sum_system->Sum > 0.f );
+		};
+
+		TEST_METHOD( ConcurrentStorages ) {
+			auto acheron = acs::AcheronComponentSystem{ };
+
+			acheron.ResizeWorkerPool( 4 );
+
+			auto* first	 = acheron.Register<ConcurrentSystem<10>>( true );
+			auto* second = acheron.Register<ConcurrentSystem<11>>( true );
+
+			Assert::AreEqual( acheron.GetSystemManager( ).GetBatchCount( ), uint32_t( 1 ) );
+
+			acheron.Process( nullptr );
+
+			Assert::IsTrue( first->IsConcurrent );
+			Assert::IsTrue( second->IsConcurrent );
+			Assert::IsFalse( acheron.GetComponentManager( ).GetIsConcurrent( ) );
+			Assert::AreEqual( acheron.GetStorage<Work<10>>( ).GetCount( ), uint32_t( 0 ) );
+		};
+
+		TEST_METHOD( TagFilterAccess ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto entities = std::vector<acs::AcheronUUID>( 64 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities )
+				acheron.Append( entity, Position{ } );
+
+			acheron.ResizeWorkerPool( 4 );
+			acheron.Register<IgnoreSystem>( true );
+
+			auto* sum_system = acheron.Register<FilteredSumSystem>( true );
+
+			Assert::IsTrue( acheron.GetSystemManager( ).Get<FilteredSumSystem>( )->Access.GetIsConflicting( acs::AcheronSystemAccess::Make<acs::AcheronTag>( ) ) );
+			Assert::AreEqual( acheron.GetSystemManager( ).GetBatchCount( ), uint32_t( 2 ) );
+
+			acheron.Process( nullptr );
+
+			Assert::AreEqual( sum_system->GetProcessedCount( ), uint32_t( 0 ) );
+		};
+
+		TEST_METHOD( Ordering ) {
+			auto acheron = acs::AcheronComponentSystem{ };
+			auto log	 = std::vector<uint32_t>{ };
+
+			acheron.Register<LogSystem<0>>( true );
+			acheron.Register<LogSystem<1>>( true );
+			acheron.Register<LogSystem<2>>( true );
+			acheron.Register<LogSystem<3>>( true );
+			acheron.RunBefore<LogSystem<2>, LogSystem<0>>( );
+			acheron.RunAfter<LogSystem<1>, LogSystem<3>>( );
+			acheron.SetStage<LogSystem<3>>( acs::ACS_Stage_PreUpdate );
+
+			const auto entity = acheron.Create( );
+
+			acheron.Destroy( entity, true );
+
+			Assert::IsTrue( acheron.GetIsSweepPending( ) );
+
+			acheron.Process( &log );
+
+			Assert::IsTrue( log == std::vector<uint32_t>{ 3, 1, 2, 0 } );
+			Assert::IsFalse( acheron.GetIsSweepPending( ) );
+
+			acheron.RunBefore<LogSystem<0>, LogSystem<1>>( );
+			acheron.SetStage<LogSystem<2>>( acs::ACS_Stage_PostUpdate );
+
+			log.clear( );
+			acheron.Process( &log );
+
+			Assert::IsTrue( log == std::vector<uint32_t>{ 3, 0, 1, 2 } );
+			Assert::AreEqual( acheron.GetSystemManager( ).GetBatchCount( ), uint32_t( 4 ) );
+		};
+
+		TEST_METHOD( TickPolicies ) {
+			auto acheron = acs::AcheronComponentSystem{ };
+			auto log	 = std::vector<uint32_t>{ };
+			auto count	 = [ & ]( const uint32_t id ) -> size_t {
+				return size_t( std::count( log.begin( ), log.end( ), id ) );
+			};
+
+			acheron.Register<LogSystem<0>>( true );
+			acheron.Register<LogSystem<1>>( true );
+			acheron.Register<LogSystem<2>>( true );
+			acheron.Register<LogSystem<3>>( false );
+			acheron.SetTickPolicy<LogSystem<1>>( acs::AcheronSystemTick::MakeInterval( 3 ) );
+			acheron.SetTickPolicy<LogSystem<2>>( acs::AcheronSystemTick::MakeFixedStep( 0.5f, 4 ) );
+
+			Assert::AreEqual( acheron.GetSystemManager( ).GetBatchCount( ), uint32_t( 3 ) );
+
+			for ( auto tick = 0; tick < 6; tick++ )
+				acheron.Process( &log, 0.25f );
+
+			Assert::AreEqual( count( 0 ), size_t( 6 ) );
+			Assert::AreEqual( count( 1 ), size_t( 2 ) );
+			Assert::AreEqual( count( 2 ), size_t( 3 ) );
+			Assert::AreEqual( count( 3 ), size_t( 0 ) );
+
+			log.clear( );
+			acheron.Disable<LogSystem<0>>( nullptr );
+			acheron.Enable<LogSystem<3>>( nullptr );
+			acheron.Process( &log, 10.f );
+
+			Assert::AreEqual( count( 0 ), size_t( 0 ) );
+			Assert::AreEqual( count( 2 ), size_t( 4 ) );
+			Assert::AreEqual( count( 3 ), size_t( 1 ) );
+
+			auto budget = acs::AcheronSystemTick::MakeBudget( 1.f );
+
+			Assert::AreEqual( budget.Advance( 0.f ), uint32_t( 1 ) );
+
+			budget.Consume( 3.5f );
+
+			for ( auto tick = 0; tick < 3; tick++ )
+				Assert::AreEqual( budget.Advance( 0.f ), uint32_t( 0 ) );
+
+			Assert::AreEqual( budget.Advance( 0.f ), uint32_t( 1 ) );
+		};
+
+		TEST_METHOD( Profiling ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto entities = std::vector<acs::AcheronUUID>( 100 );
+			auto trace	  = std::ostringstream{ };
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities ) {
+				acheron.Append( entity, Position{ } );
+				acheron.Append( entity, Velocity{ } );
+				acheron.Append( entity, Age{ } );
+			}
+
+			acheron.Register<MoveSystem>( true );
+			acheron.Register<acs::AcheronPipeline<StaticMoveSystem, StaticAgeSystem>>( true );
+			acheron.StartTrace( );
+
+			for ( auto tick = 0; tick < 4; tick++ )
+				acheron.Process( nullptr );
+
+			acheron.StopTrace( trace );
+
+#   ifdef ACS_ENABLE_PROFILING
+			const auto* profile = acheron.GetProfile<MoveSystem>( );
+			const auto* pipeline_profile = acheron.GetProfile<acs::AcheronPipeline<StaticMoveSystem, StaticAgeSystem>>( );
+
+			Assert::IsNotNull( profile );
+			Assert::IsNotNull( pipeline_profile );
+			Assert::AreEqual( profile->ProcessTimes.GetCount( ), uint32_t( 4 ) );
+			Assert::AreEqual( profile->EntityCounts.GetLast( ), 100.f );
+			Assert::AreEqual( pipeline_profile->EntityCounts.GetLast( ), 200.f );
+
+			const auto stats = profile->ProcessTimes.GetStats( );
+
+			Assert::IsTrue( stats.P50 <= stats.P95 && stats.P95 <= stats.P99 && stats.P99 <= stats.Max );
+
+			const auto json = trace.str( );
+
+			Assert::IsTrue( json.starts_with( "{\"traceEvents\":[{" ) );
+			Assert::IsTrue( json.find( "MoveSystem" ) != std::string::npos );
+			Assert::AreEqual( size_t( std::count( json.begin( ), json.end( ), '{' ) ), size_t( 1 + 8 * 2 ) );
+#   else
+			Assert::IsNull( acheron.GetProfile<MoveSystem>( ) );
+			Assert::IsTrue( trace.str( ).empty( ) );
+#   endif
+		};
+
+		TEST_METHOD( ProfileBackend ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto backend  = CountBackend{ };
+			auto entities = std::vector<acs::AcheronUUID>( 100 );
+
+			acs::SetProfileBackend( &backend );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities ) {
+				acheron.Append( entity, Position{ } );
+				acheron.Append( entity, Velocity{ } );
+			}
+
+			acheron.Register<MoveSystem>( true );
+			acheron.Process( nullptr );
+			acheron.Destroy( entities[ 0 ], true );
+			acheron.Sweep( );
+
+			acs::SetProfileBackend( nullptr );
+
+#   ifdef ACS_ENABLE_PROFILING
+			Assert::IsTrue( backend.Begins == backend.Ends );
+			Assert::AreEqual( backend.Begins[ "AcheronEntityManager::CreateRange" ], uint32_t( 1 ) );
+			Assert::AreEqual( backend.Begins[ "AcheronComponentStorage<Sorted>::Append" ], uint32_t( 200 ) );
+			Assert::IsTrue( backend.Begins[ "AcheronComponentCache::ComputeCache" ] > 0 );
+			Assert::AreEqual( backend.Begins[ "AcheronSystemManager::Process" ], uint32_t( 1 ) );
+			Assert::AreEqual( backend.Begins[ "AcheronContext::Sweep" ], uint32_t( 1 ) );
+			Assert::AreEqual( backend.Counters[ "AcheronContext::SweepEntities" ], int64_t( 1 ) );
+			Assert::IsTrue( backend.Counters[ "AcheronComponentStorage<Sorted>::Capacity" ] >= int64_t( 100 ) );
+#   else
+			Assert::IsTrue( backend.Begins.empty( ) && backend.Counters.empty( ) );
+#   endif
+
+			auto tracer = acs::AcheronRingTracer{ 8 };
+			auto trace  = std::ostringstream{ };
+
+			for ( auto scope = 0; scope < 5; scope++ ) {
+				tracer.BeginScope( "Scope" );
+				tracer.EndScope( "Scope" );
+			}
+
+			tracer.Counter( "Count", 42 );
+			tracer.EndScope( "Scope" );
+			tracer.Write( trace );
+
+			const auto json = trace.str( );
+
+			Assert::AreEqual( tracer.GetCount( ), uint32_t( 8 ) );
+			Assert::IsTrue( json.starts_with( "{\"traceEvents\":[{\"name\":\"Scope\",\"cat\":\"acs\",\"ph\":\"B\"" ) );
+			Assert::AreEqual( size_t( std::count( json.begin( ), json.end( ), '{' ) ), size_t( 1 + 6 + 1 + 1 ) );
+			Assert::IsTrue( json.find( "\"args\":{\"Count\":42}" ) != std::string::npos );
+		};
+
+		TEST_METHOD( ParallelEach ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto entities = std::vector<acs::AcheronUUID>( 10000 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities ) {
+				acheron.Append( entity, Position{ } );
+				acheron.Append( entity, Velocity{ } );
+			}
+
+			acheron.ResizeWorkerPool( 4 );
+
+			auto view   = acs::AcheronComponentView<Age, const Velocity>( acheron, acheron );
+			auto visits = std::atomic<uint32_t>{ 0 };
+
+			view.ParallelEach( [ & ]( auto& components ) { visits += 1; }, 64 );
+
+			Assert::AreEqual( visits.load( ), uint32_t( 0 ) );
+
+			for ( auto index = size_t( 0 ); index < entities.size( ); index += 2 )
+				acheron.Append( entities[ index ], Age{ } );
+
+			auto age_view = acs::AcheronComponentView<Age, const Velocity>( acheron, acheron );
+
+			age_view.ParallelEach( [ & ]( std::tuple<acs::AcheronUUID, Age*, const Velocity*>& components ) {
+				std::get<1>( components )->Value += 1;
+
+				visits += 1;
+			}, 64 );
+
+			Assert::AreEqual( visits.load( ), uint32_t( entities.size( ) / 2 ) );
+			Assert::IsFalse( acheron.GetComponentManager( ).GetStorage<Age>( ).GetIsLocked( ) );
+
+			for ( auto index = size_t( 0 ); index < entities.size( ); index += 2 )
+				Assert::AreEqual( acheron.GetComponent<Age>( entities[ index ] )->Value, uint32_t( 1 ) );
+
+			acheron.Register<ParallelMoveSystem>( true );
+
+			for ( auto frame = 0; frame < 4; frame++ )
+				acheron.Process( nullptr );
+
+			for ( const auto entity : entities )
+				Assert::AreEqual( acheron.GetComponent<Position>( entity )->Value, 4.f );
+		};
+
+		TEST_METHOD( BatchProcess ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto entities = std::vector<acs::AcheronUUID>( 1000 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities ) {
+				acheron.Append( entity, Position{ } );
+				acheron.Append( entity, Velocity{ } );
+			}
+
+			auto* move_system = acheron.Register<BatchMoveSystem>( true );
+
+			acheron.Process( nullptr );
+
+			Assert::AreEqual( move_system->BatchCount, uint32_t( 1 ) );
+
+			acheron.Remove<Velocity>( entities[ 500 ] );
+			acheron.Process( nullptr );
+
+			Assert::AreEqual( move_system->BatchCount, uint32_t( 3 ) );
+			Assert::AreEqual( acheron.GetComponent<Position>( entities[ 500 ] )->Value, 1.f );
+
+			for ( auto index = size_t( 0 ); index < entities.size( ); index++ ) {
+				if ( index != 500 )
+					Assert::AreEqual( acheron.GetComponent<Position>( entities[ index ] )->Value, 2.f );
+			}
+		};
+
+		TEST_METHOD( StructuralProcess ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto entities = std::vector<acs::AcheronUUID>( 1000 );
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities ) {
+				acheron.Append( entity, Position{ } );
+				acheron.Append( entity, Velocity{ } );
+			}
+
+			auto* move_system = acheron.Register<StructuralMoveSystem>( true );
+
+			move_system->Target = entities[ 500 ];
+
+			acheron.Process( nullptr );
+
+			for ( auto index = size_t( 0 ); index < entities.size( ); index++ )
+				Assert::AreEqual( acheron.GetComponent<Position>( entities[ index ] )->Value, ( index != 500 ) ? 1.f : 0.f );
+		};
+
+		TEST_METHOD( StaticPipeline ) {
+			auto acheron  = acs::AcheronComponentSystem{ };
+			auto entities = std::vector<acs::AcheronUUID>( 1000 );
+			auto pipeline = acs::AcheronPipeline<acs::AcheronFuse<StaticMoveSystem, StaticClampSystem>, StaticAgeSystem>{ };
+
+			acheron.Create( uint32_t( entities.size( ) ), entities );
+
+			for ( const auto entity : entities ) {
+				acheron.Append( entity, Position{ } );
+				acheron.Append( entity, Velocity{ } );
+				acheron.Append( entity, Age{ } );
+			}
+
+			for ( auto frame = 0; frame < 5; frame++ )
+				pipeline.Process( acheron, nullptr );
+
+			for ( const auto entity : entities ) {
+				Assert::AreEqual( acheron.GetComponent<Position>( entity )->Value, 3.f );
+				Assert::AreEqual( acheron.GetComponent<Age>( entity )->Value, uint32_t( 5 ) );
+			}
+
+			const auto access = pipeline.GetAccess( );
+
+			Assert::IsFalse( access.IsExclusive );
+			Assert::AreEqual( access.Writes.size( ), size_t( 2 ) );
+			Assert::AreEqual( access.Reads.size( ), size_t( 1 ) );
+
+			acheron.Register<acs::AcheronPipeline<StaticMoveSystem, StaticAgeSystem>>( true );
+			acheron.Process( nullptr );
+
+			for ( const auto entity : entities ) {
+				Assert::AreEqual( acheron.GetComponent<Position>( entity )->Value, 4.f );
+				Assert::AreEqual( acheron.GetComponent<Age>( entity )->Value, uint32_t( 6 ) );
+			}
+		};
+
+		TEST_METHOD( Bench_StaticPipeline ) {
+			const auto count = uint32_t( 500000 );
+			auto acheron     = acs::AcheronComponentSystem{ };
+			auto entities    = std::vector<acs::AcheronUUID>( count );
+			auto positions   = std::vector<Position>( count );
+			auto velocites   = std::vector<Velocity>( count );
+			auto ages        = std::vector<Age>( count );
+
+			acheron.Create( count, entities );
+			acheron.AppendRange<Position>( entities, positions );
+			acheron.AppendRange<Velocity>( entities, velocites );
+			acheron.AppendRange<Age>( entities, ages );
+			acheron.Register<MoveSystem>( true );
+			acheron.Register<AgeSystem>( true );
+			acheron.Process( nullptr );
+
+			acs_test::Bench( L"Dynamic move and age", count * 2, [ & ]( ) {
+				acheron.Process( nullptr );
+			} );
+
+			auto pipeline = acs::AcheronPipeline<StaticMoveSystem, StaticAgeSystem>{ };
+
+			pipeline.Process( acheron, nullptr );
+
+			acs_test::Bench( L"Static move and age", count * 2, [ & ]( ) {
+				pipeline.Process( acheron, nullptr );
+			} );
+
+			auto clamp_pipeline = acs::AcheronPipeline<StaticMoveSystem, StaticClampSystem>{ };
+			auto fused_pipeline = acs::AcheronPipeline<acs::AcheronFuse<StaticMoveSystem, StaticClampSystem>>{ };
+
+			clamp_pipeline.Process( acheron, nullptr );
+			fused_pipeline.Process( acheron, nullptr );
+
+			acs_test::Bench( L"Static move and clamp", count * 2, [ & ]( ) {
+				clamp_pipeline.Process( acheron, nullptr );
+			} );
+
+			acs_test::Bench( L"Fused move and clamp", count * 2, [ & ]( ) {
+				fused_pipeline.Process( acheron, nullptr );
+			} );
+		};
+
+		TEST_METHOD( Bench_BatchProcess ) {
+			const auto count = uint32_t( 500000 );
+
+			for ( auto is_batch : { false, true } ) {
+				auto acheron   = acs::AcheronComponentSystem{ };
+				auto entities  = std::vector<acs::AcheronUUID>( count );
+				auto positions = std::vector<Position>( count );
+				auto velocites = std::vector<Velocity>( count );
+
+				acheron.Create( count, entities );
+				acheron.AppendRange<Position>( entities, positions );
+				acheron.AppendRange<Velocity>( entities, velocites );
+
+				if ( is_batch )
+					acheron.Register<BatchMoveSystem>( true );
+				else
+					acheron.Register<MoveSystem>( true );
+
+				acheron.Process( nullptr );
+
+				acs_test::Bench( is_batch ? L"Move batch" : L"Move per entity", count, [ & ]( ) {
+					acheron.Process( nullptr );
+				} );
+			}
+		};
+
+		TEST_METHOD( Bench_ParallelEach ) {
+			const auto count = uint32_t( 500000 );
+			const auto worker_count = std::max( std::thread::hardware_concurrency( ), 2u ) - 1;
+
+			for ( auto is_parallel : { false, true } ) {
+				auto acheron   = acs::AcheronComponentSystem{ };
+				auto entities  = std::vector<acs::AcheronUUID>( count );
+				auto positions = std::vector<Position>( count );
+				auto velocites = std::vector<Velocity>( count );
+
+				acheron.Create( count, entities );
+				acheron.AppendRange<Position>( entities, positions );
+				acheron.AppendRange<Velocity>( entities, velocites );
+				acheron.ResizeWorkerPool( worker_count );
+
+				if ( is_parallel )
+					acheron.Register<ParallelMoveSystem>( true );
+				else
+					acheron.Register<MoveSystem>( true );
+
+				acheron.Process( nullptr );
+
+				acs_test::Bench( is_parallel ? L"Move parallel each" : L"Move serial each", count, [ & ]( ) {
+					acheron.Process( nullptr );
+				} );
+			}
+		};
+
+		TEST_METHOD( Bench_ParallelProcess ) {
+			const auto count = uint32_t( 100000 );
+
+			for ( auto worker_count : { 0u, std::max( std::thread::hardware_concurrency( ), 2u ) - 1 } ) {
+				auto acheron  = acs::AcheronComponentSystem{ };
+				auto entities = std::vector<acs::AcheronUUID>( count );
+
+				acheron.Create( count, entities );
+
+				[ & ]<uint32_t... Ids>( std::integer_sequence<uint32_t, Ids...> ) -> void {
+					( [ & ]( ) -> void {
+						auto works = std::vector<Work<Ids>>( count );
+
+						acheron.AppendRange<Work<Ids>>( entities, works );
+						acheron.Register<WorkSystem<Ids>>( true );
+					}( ), ... );
+				}( std::make_integer_sequence<uint32_t, 4>{ } );
+
+				acheron.ResizeWorkerPool( worker_count );
+
+				acs_test::Bench( L"Process 4 systems " + std::to_wstring( worker_count ) + L" workers", count * 4, [ & ]( ) {
+					acheron.Process( nullptr );
+				} );
+			}
+		};
+
 	};
 
 };
@@ -25,4 +25,18 @@ namespace acs_test {
 		Logger::WriteMessage( message_str );
 	}
 
+	void Bench( const std::wstring& name, const uint32_t operation_count, std::function<void( )> executor ) {
+		const auto start = std::chrono::high_resolution_clock::now( );
+
+		std::invoke( executor );
+
+		const auto stop = std::chrono::high_resolution_clock::now( );
+		const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>( stop - start );
+		const auto operation_cost = double( duration.count( ) ) / double( std::max( operation_count, uint32_t( 1 ) ) );
+		const auto bench_message = std::format( L"Bench {} executed in : {} microseconds ( {:.2f} ns per operation ).", name, duration.count( ) / 1000, operation_cost );
+		const auto* message_str = bench_message.c_str( );
+
+		Logger::WriteMessage( message_str );
+	}
+
 };
@@ -37,6 +37,7 @@
 #include <CppUnitTest.h>
 #include <iostream>
 #include <random>
+#include <sstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -59,4 +60,14 @@ namespace acs_test {
 	 **/
 	void Bench( const std::wstring& name, std::function<void( )> executor );
 
+	/**
+	 * Bench method
+	 * @note : Simple benchmark for tests that also report the cost per 
+	 *		   operation.
+	 * @param name : Name of the current bench.
+	 * @param operation_count : Operation count executed by the executor.
+	 * @param executor : Benching lambda function.
+	 **/
+	void Bench( const std::wstring& name, const uint32_t operation_count, std::function<void( )> executor );
+
 };